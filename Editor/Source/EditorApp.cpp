@@ -542,7 +542,7 @@ namespace Enjon
 			{
 				// Get component list
 				AssetManager* am = EngineSubsystem( AssetManager );
-				const HashMap<String, AssetRecordInfo>* scenes = am->GetAssets<Scene>( );
+				const HashMap<UUID, AssetRecordInfo>* scenes = am->GetAssets<Scene>( );
 
 				for ( auto& record : *scenes )
 				{ 
@@ -1695,7 +1695,7 @@ namespace Enjon
 						else if ( EditorTransformWidget::IsValidID( pr.mId ) )
 						{
 							// Begin widget interaction
-							mTransformWidget.BeginInteraction( TransformWidgetRenderableType( pr.mId - MAX_ENTITIES ), mWorldOutlinerView->GetSelectedEntity( ).Get( )->GetWorldTransform( ) );
+							mTransformWidget.BeginInteraction( TransformWidgetRenderableType( pr.mId - RESERVED_RENDERABLE_ID_BEGIN ), mWorldOutlinerView->GetSelectedEntity( ).Get( )->GetWorldTransform( ) );
 						}
 						else
 						{
@@ -50,10 +50,10 @@ namespace Enjon
 		mUpAxis.mLocalTransform.SetScale( Vec3( xzScale, yScale, xzScale ) );
 
 		// Set renderable ids 
-		mRoot.mRenderable.SetRenderableID( MAX_ENTITIES + (u32)TransformWidgetRenderableType::TranslationRoot );
-		mForwardAxis.mRenderable.SetRenderableID( MAX_ENTITIES + (u32)TransformWidgetRenderableType::RotationForwardAxis );
-		mUpAxis.mRenderable.SetRenderableID( MAX_ENTITIES + (u32)TransformWidgetRenderableType::RotationUpAxis );
-		mRightAxis.mRenderable.SetRenderableID( MAX_ENTITIES + (u32)TransformWidgetRenderableType::RotationRightAxis );
+		mRoot.mRenderable.SetRenderableID( RESERVED_RENDERABLE_ID_BEGIN + (u32)TransformWidgetRenderableType::TranslationRoot );
+		mForwardAxis.mRenderable.SetRenderableID( RESERVED_RENDERABLE_ID_BEGIN + (u32)TransformWidgetRenderableType::RotationForwardAxis );
+		mUpAxis.mRenderable.SetRenderableID( RESERVED_RENDERABLE_ID_BEGIN + (u32)TransformWidgetRenderableType::RotationUpAxis );
+		mRightAxis.mRenderable.SetRenderableID( RESERVED_RENDERABLE_ID_BEGIN + (u32)TransformWidgetRenderableType::RotationRightAxis );
 
 		// Add transformation hierarchies
 		mTransformHeirarchies.push_back( &mRoot );
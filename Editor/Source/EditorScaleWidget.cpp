@@ -88,16 +88,16 @@ namespace Enjon
 		mYZAxis.mLocalTransform.SetPosition( Vec3( 0.0f, 0.0f, 9.0f ) ); 
 
 		// Set renderable ids 
-		mRoot.mRenderable.SetRenderableID( MAX_ENTITIES + (u32)TransformWidgetRenderableType::ScaleRoot );
-		mForwardAxis.mRenderable.SetRenderableID( MAX_ENTITIES + (u32)TransformWidgetRenderableType::ScaleForwardAxis );
-		mUpAxis.mRenderable.SetRenderableID( MAX_ENTITIES + (u32)TransformWidgetRenderableType::ScaleUpAxis );
-		mRightAxis.mRenderable.SetRenderableID( MAX_ENTITIES + (u32)TransformWidgetRenderableType::ScaleRightAxis );
-		mForwardAxisArrow.mRenderable.SetRenderableID( MAX_ENTITIES + ( u32 )TransformWidgetRenderableType::ScaleForwardAxis );
-		mUpAxisArrow.mRenderable.SetRenderableID( MAX_ENTITIES + (u32)TransformWidgetRenderableType::ScaleUpAxis );
-		mRightAxisArrow.mRenderable.SetRenderableID( MAX_ENTITIES + (u32)TransformWidgetRenderableType::ScaleRightAxis );
-		mYZAxis.mRenderable.SetRenderableID( MAX_ENTITIES + ( u32 )TransformWidgetRenderableType::ScaleYZAxes );
-		mXYAxis.mRenderable.SetRenderableID( MAX_ENTITIES + ( u32 )TransformWidgetRenderableType::ScaleXYAxes );
-		mXZAxis.mRenderable.SetRenderableID( MAX_ENTITIES + ( u32 )TransformWidgetRenderableType::ScaleXZAxes );
+		mRoot.mRenderable.SetRenderableID( RESERVED_RENDERABLE_ID_BEGIN + (u32)TransformWidgetRenderableType::ScaleRoot );
+		mForwardAxis.mRenderable.SetRenderableID( RESERVED_RENDERABLE_ID_BEGIN + (u32)TransformWidgetRenderableType::ScaleForwardAxis );
+		mUpAxis.mRenderable.SetRenderableID( RESERVED_RENDERABLE_ID_BEGIN + (u32)TransformWidgetRenderableType::ScaleUpAxis );
+		mRightAxis.mRenderable.SetRenderableID( RESERVED_RENDERABLE_ID_BEGIN + (u32)TransformWidgetRenderableType::ScaleRightAxis );
+		mForwardAxisArrow.mRenderable.SetRenderableID( RESERVED_RENDERABLE_ID_BEGIN + ( u32 )TransformWidgetRenderableType::ScaleForwardAxis );
+		mUpAxisArrow.mRenderable.SetRenderableID( RESERVED_RENDERABLE_ID_BEGIN + (u32)TransformWidgetRenderableType::ScaleUpAxis );
+		mRightAxisArrow.mRenderable.SetRenderableID( RESERVED_RENDERABLE_ID_BEGIN + (u32)TransformWidgetRenderableType::ScaleRightAxis );
+		mYZAxis.mRenderable.SetRenderableID( RESERVED_RENDERABLE_ID_BEGIN + ( u32 )TransformWidgetRenderableType::ScaleYZAxes );
+		mXYAxis.mRenderable.SetRenderableID( RESERVED_RENDERABLE_ID_BEGIN + ( u32 )TransformWidgetRenderableType::ScaleXYAxes );
+		mXZAxis.mRenderable.SetRenderableID( RESERVED_RENDERABLE_ID_BEGIN + ( u32 )TransformWidgetRenderableType::ScaleXZAxes );
 
 		// Add transformation hierarchies
 		mTransformHeirarchies.push_back( &mRoot );
@@ -1340,7 +1340,7 @@ namespace Enjon
 
 	bool EditorTransformWidget::IsValidID( const u32& id )
 	{
-		s32 value = ( s32 )id - MAX_ENTITIES;
+		s32 value = ( s32 )id - RESERVED_RENDERABLE_ID_BEGIN;
 		if ( value >= 0 && value < ( s32 )TransformWidgetRenderableType::Count )
 		{
 			return true;
@@ -90,16 +90,16 @@ namespace Enjon
 		mYZAxis.mLocalTransform.SetPosition( Vec3( 0.0f, 0.0f, 9.0f ) ); 
 
 		// Set renderable ids 
-		mRoot.mRenderable.SetRenderableID( MAX_ENTITIES + (u32)TransformWidgetRenderableType::TranslationRoot );
-		mForwardAxis.mRenderable.SetRenderableID( MAX_ENTITIES + (u32)TransformWidgetRenderableType::TranslationForwardAxis );
-		mUpAxis.mRenderable.SetRenderableID( MAX_ENTITIES + (u32)TransformWidgetRenderableType::TranslationUpAxis );
-		mRightAxis.mRenderable.SetRenderableID( MAX_ENTITIES + (u32)TransformWidgetRenderableType::TranslationRightAxis );
-		mForwardAxisArrow.mRenderable.SetRenderableID( MAX_ENTITIES + ( u32 )TransformWidgetRenderableType::TranslationForwardAxis );
-		mUpAxisArrow.mRenderable.SetRenderableID( MAX_ENTITIES + (u32)TransformWidgetRenderableType::TranslationUpAxis );
-		mRightAxisArrow.mRenderable.SetRenderableID( MAX_ENTITIES + (u32)TransformWidgetRenderableType::TranslationRightAxis );
-		mYZAxis.mRenderable.SetRenderableID( MAX_ENTITIES + ( u32 )TransformWidgetRenderableType::TranslationYZAxes );
-		mXYAxis.mRenderable.SetRenderableID( MAX_ENTITIES + ( u32 )TransformWidgetRenderableType::TranslationXYAxes );
-		mXZAxis.mRenderable.SetRenderableID( MAX_ENTITIES + ( u32 )TransformWidgetRenderableType::TranslationXZAxes );
+		mRoot.mRenderable.SetRenderableID( RESERVED_RENDERABLE_ID_BEGIN + (u32)TransformWidgetRenderableType::TranslationRoot );
+		mForwardAxis.mRenderable.SetRenderableID( RESERVED_RENDERABLE_ID_BEGIN + (u32)TransformWidgetRenderableType::TranslationForwardAxis );
+		mUpAxis.mRenderable.SetRenderableID( RESERVED_RENDERABLE_ID_BEGIN + (u32)TransformWidgetRenderableType::TranslationUpAxis );
+		mRightAxis.mRenderable.SetRenderableID( RESERVED_RENDERABLE_ID_BEGIN + (u32)TransformWidgetRenderableType::TranslationRightAxis );
+		mForwardAxisArrow.mRenderable.SetRenderableID( RESERVED_RENDERABLE_ID_BEGIN + ( u32 )TransformWidgetRenderableType::TranslationForwardAxis );
+		mUpAxisArrow.mRenderable.SetRenderableID( RESERVED_RENDERABLE_ID_BEGIN + (u32)TransformWidgetRenderableType::TranslationUpAxis );
+		mRightAxisArrow.mRenderable.SetRenderableID( RESERVED_RENDERABLE_ID_BEGIN + (u32)TransformWidgetRenderableType::TranslationRightAxis );
+		mYZAxis.mRenderable.SetRenderableID( RESERVED_RENDERABLE_ID_BEGIN + ( u32 )TransformWidgetRenderableType::TranslationYZAxes );
+		mXYAxis.mRenderable.SetRenderableID( RESERVED_RENDERABLE_ID_BEGIN + ( u32 )TransformWidgetRenderableType::TranslationXYAxes );
+		mXZAxis.mRenderable.SetRenderableID( RESERVED_RENDERABLE_ID_BEGIN + ( u32 )TransformWidgetRenderableType::TranslationXZAxes );
 
 		// Add transformation hierarchies
 		mTransformHeirarchies.push_back( &mRoot );
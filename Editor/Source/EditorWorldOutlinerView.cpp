@@ -488,16 +488,12 @@ namespace Enjon
 			//EntityHandle selectedEntityHandle = mApp->GetSelectedEntity( );
 			EntityHandle selectedEntityHandle = GetSelectedEntity( );
 			Entity* selectedEntity = selectedEntityHandle.Get( );
-			for ( auto& e : entities->GetEntitiesByWorld( mWindow->GetWorld( ) ) )
+			// Indexed since reparenting through drag and drop can change root list while it's displayed
+			const Vector< Entity* >& roots = entities->GetRootEntitiesByWorld( mWindow->GetWorld( ) );
+			for ( u32 i = 0; i < roots.size( ); ++i )
 			{ 
-				// SKip over non-root entities
-				if ( e->HasParent( ) )
-				{
-					continue;
-				} 
-
 				// Display entity
-				anyItemHovered |= DisplayEntityRecursively( e, &entityNumber ); 
+				anyItemHovered |= DisplayEntityRecursively( roots[ i ], &entityNumber ); 
 			} 
 		}
 		ImGui::ListBoxFooter( ); 
@@ -95,6 +95,7 @@ struct PropertyTraits
 	bool IsVisible = true;
 	bool IsEditable = true;
 	bool IsSerializable = true;
+	bool IsInstanceShared = false;
 	float UIMin = 0.0f;
 	float UIMax = 0.0f;
 	std::vector <std::string> mAccessors;
@@ -218,6 +219,8 @@ struct ClassMarkupTraits
 	bool mConstruct = true;
 	MetaClassType mMetaClassType = MetaClassType::Object;
 	std::vector< std::string > mRequiredClasses;
+	std::vector< std::string > mReadClasses;
+	std::vector< std::string > mWriteClasses;
 };
 
 class Class
@@ -379,6 +382,8 @@ class Introspection
 
 		void Link( const ReflectionConfig& config );
 
+		void LinkTypeIds( const ReflectionConfig& config );
+
 		PropertyType GetTypeFromString( const std::string& str );
 		std::string GetTypeAsString( PropertyType type );
 
@@ -83,6 +83,9 @@ int main( int argc, char** argv )
 
 	// Link all classes into one generated file
 	mIntrospection.Link( mConfig ); 
+
+	// Write compile time type ids of all classes into generated header
+	mIntrospection.LinkTypeIds( mConfig );
 }
  
 //====================================================================================
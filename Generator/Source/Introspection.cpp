@@ -494,16 +494,25 @@ void Introspection::ParseComponentTraits( Lexer*lexer, Class* cls )
 	Token curToken = lexer->GetCurrentToken( );
 	while ( !curToken.IsType( TokenType::Token_CloseParen ) && !curToken.IsType( TokenType::Token_EndOfStream ) )
 	{
-		// Requires
+		// Requires / Reads / Writes
+		std::vector< std::string >* classList = nullptr;
 		if ( curToken.Equals( "Requires" ) )
-		{ 
-			// Must be of type component for this meta tag to work properly
-			if ( cls->mTraits.mMetaClassType != MetaClassType::Component )
-			{
-				continue;
-			} 
+		{
+			classList = &cls->mTraits.mRequiredClasses;
+		}
+		else if ( curToken.Equals( "Reads" ) )
+		{
+			classList = &cls->mTraits.mReadClasses;
+		}
+		else if ( curToken.Equals( "Writes" ) )
+		{
+			classList = &cls->mTraits.mWriteClasses;
+		}
 
-			// Require opening bracket for require
+		// Must be of type component for these meta tags to work properly
+		if ( classList && cls->mTraits.mMetaClassType == MetaClassType::Component )
+		{ 
+			// Require opening bracket for class list
 			if ( !lexer->RequireToken( TokenType::Token_OpenBracket, true ) )
 			{
 				return;
@@ -512,14 +521,13 @@ void Introspection::ParseComponentTraits( Lexer*lexer, Class* cls )
 			// Parse until closed bracket is found or EOF
 			Token token = lexer->GetNextToken( ); 
 
-			while ( !token.IsType( TokenType::Token_CloseBracket ) || token.IsType( TokenType::Token_EndOfStream ) )
+			while ( !token.IsType( TokenType::Token_CloseBracket ) && !token.IsType( TokenType::Token_EndOfStream ) )
 			{
-				// Parse identifier for require
+				// Parse identifier for class
 				if ( token.IsType( TokenType::Token_Identifier ) )
 				{
-
-					// Add the required meta class back
-					cls->mTraits.mRequiredClasses.push_back( token.ToString( ) );
+					// Add the meta class to the list
+					classList->push_back( token.ToString( ) );
 				}
 
 				// Grab next token
@@ -835,6 +843,11 @@ void Introspection::ParseProperty( Lexer* lexer, Class* cls )
 					traits.IsEditable = false;
 				}
 
+				if ( curToken.Equals( "InstanceShared" ) )
+				{
+					traits.IsInstanceShared = true;
+				}
+
 				// Parse delegates
 				if ( curToken.Equals( "Delegates" ) )
 				{
@@ -1730,6 +1743,13 @@ void Introspection::Compile( const ReflectionConfig& config )
 				code += OutputTabbedLine( "cls->mConstructor = ([](){" );
 				code += OutputTabbedLine( "\treturn new " + qualifiedName + "();" );
 				code += OutputTabbedLine( "});" ); 
+
+				// In place construction and size information ( used by pooled/chunked storage )
+				code += OutputTabbedLine( "cls->mPlacementConstructor = ([]( void* mem ){" );
+				code += OutputTabbedLine( "\treturn new ( mem ) " + qualifiedName + "();" );
+				code += OutputTabbedLine( "});" ); 
+				code += OutputTabbedLine( "cls->mTypeSize = sizeof( " + qualifiedName + " );" );
+				code += OutputTabbedLine( "cls->mTypeAlignment = alignof( " + qualifiedName + " );" );
 			}
 
 			// Iterate through all functions and output code
@@ -1792,6 +1812,7 @@ void Introspection::Compile( const ReflectionConfig& config )
 					flags += !prop.second->mTraits.IsEditable		? "MetaPropertyFlags::ReadOnly | "			: "MetaPropertyFlags::Default | ";
 					flags += !prop.second->mTraits.IsSerializable	? "MetaPropertyFlags::NonSerializeable | "	: "MetaPropertyFlags::Default | ";
 					flags += !prop.second->mTraits.IsVisible		? "MetaPropertyFlags::HideInEditor | "		: "MetaPropertyFlags::Default | ";
+					flags += prop.second->mTraits.IsInstanceShared	? "MetaPropertyFlags::InstanceShared | "	: "MetaPropertyFlags::Default | ";
 					flags += prop.second->mTraits.IsPointer			? "MetaPropertyFlags::IsPointer"			: "MetaPropertyFlags::Default";
 					flags += " )";
 					
@@ -2029,18 +2050,25 @@ void Introspection::Compile( const ReflectionConfig& config )
 			{
 				case MetaClassType::Component:
 				{
-					std::string l = "cls->mRequiredComponentList = { ";
-					for ( u32 i = 0; i < c.second.mTraits.mRequiredClasses.size( ); ++i )
+					auto outputClassList = [ & ]( const std::string& listName, const std::vector< std::string >& classes )
 					{
-						l += "\"" + c.second.mTraits.mRequiredClasses.at( i ) + "\"";
-						if ( i < c.second.mTraits.mRequiredClasses.size( ) - 1 )
+						std::string l = "cls->" + listName + " = { ";
+						for ( u32 i = 0; i < classes.size( ); ++i )
 						{
-							l += ", "; 
-						}
-					} 
-					l += " };";
+							l += "\"" + classes.at( i ) + "\"";
+							if ( i < classes.size( ) - 1 )
+							{
+								l += ", "; 
+							}
+						} 
+						l += " };";
+
+						code += OutputTabbedLine( l );
+					};
 
-					code += OutputTabbedLine( l );
+					outputClassList( "mRequiredComponentList", c.second.mTraits.mRequiredClasses );
+					outputClassList( "mReadComponentList", c.second.mTraits.mReadClasses );
+					outputClassList( "mWriteComponentList", c.second.mTraits.mWriteClasses );
 				} break;
 			}
 
@@ -2204,16 +2232,62 @@ void Introspection::Link( const ReflectionConfig& config )
 	}
 }
 
+//=================================================================================================
 
+void Introspection::LinkTypeIds( const ReflectionConfig& config )
+{
+	std::string typeIdsFilePath = config.mLinkedDirectory + "/" + config.mProjectName + "_TypeIds_Generated.h";
+	std::ofstream f( typeIdsFilePath );
 
+	std::string code = "";
 
+	code += OutputLine( "// @file " + config.mProjectName + "_TypeIds_Generated.h" );
+	code += OutputLine( "// Copyright 2016-2017 John Jackson. All Rights Reserved." );
+	code += OutputLine( "// This file has been generated. All modifications will be lost." );
+	code += OutputLine( "" );
+	code += OutputLine( "#pragma once" );
+	code += OutputLine( "" );
 
+	// Forward declare all classes within their namespaces
+	for ( auto& c : mClasses )
+	{
+		std::string decl = "";
+		for ( auto& ns : c.second.mTraits.mNamespaceQualifiers )
+		{
+			decl += "namespace " + ns + " { ";
+		}
 
+		decl += "class " + c.second.mName + ";";
 
+		for ( u32 i = 0; i < c.second.mTraits.mNamespaceQualifiers.size( ); ++i )
+		{
+			decl += " }";
+		}
 
+		code += OutputLine( decl );
+	}
 
+	code += OutputLine( "" );
 
+	// Specialize static type id for each class
+	code += OutputLine( "namespace Enjon" );
+	code += OutputLine( "{" );
+	for ( auto& c : mClasses )
+	{
+		std::string qualifiedName = c.second.GetQualifiedName( );
+		code += OutputTabbedLine( "template <>" );
+		code += OutputTabbedLine( "struct StaticTypeId< ::" + qualifiedName + " >" );
+		code += OutputTabbedLine( "{" );
+		code += OutputTabbedLine( "\tstatic constexpr bool Available = true;" );
+		code += OutputTabbedLine( "\tstatic constexpr Enjon::u32 Value = " + std::to_string( c.second.mObjectTypeId ) + ";" );
+		code += OutputTabbedLine( "};" );
+		code += OutputLine( "" );
+	}
+	code += OutputLine( "}" );
 
-
-
+	if ( f )
+	{
+		f.write( code.c_str( ), code.length( ) );
+	}
+}
 
@@ -11,7 +11,9 @@ enum MetaClassEnumDefines
 
 enum MetaClassComponentDefines
 {
-	Requires
+	Requires,
+	Reads,
+	Writes
 };
 
 // Would like for these to actually be user-defined attributes, similar to what users can define in C#
@@ -0,0 +1,54 @@
+// @file StaticTypeId.h
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+#pragma once
+#ifndef ENJON_STATIC_TYPE_ID_H
+#define ENJON_STATIC_TYPE_ID_H
+
+#include "Base/Object.h"
+#include "System/Types.h"
+#include "Defines.h"
+
+#include <type_traits>
+
+namespace Enjon
+{
+	/**
+	* @brief Type id of reflected class known at compile time. The reflection generator specializes this for every class it
+	*		 processes in <Project>_TypeIds_Generated.h.
+	*/
+	template < typename T >
+	struct StaticTypeId
+	{
+		static constexpr bool Available = false;
+	};
+}
+
+// Generated specializations, only available once the generator has been run
+#ifdef __has_include
+	#if __has_include( "Enjon_TypeIds_Generated.h" )
+		#include "Enjon_TypeIds_Generated.h"
+	#endif
+#endif
+
+namespace Enjon
+{
+	/**
+	* @brief Returns type id of T without touching the meta class registry if it's known at compile time
+	*/
+	template < typename T >
+	inline typename std::enable_if< StaticTypeId< T >::Available, u32 >::type GetStaticTypeId( )
+	{
+		return StaticTypeId< T >::Value;
+	}
+
+	/**
+	* @brief Falls back to meta class registry for types the generator hasn't emitted an id for
+	*/
+	template < typename T >
+	inline typename std::enable_if< !StaticTypeId< T >::Available, u32 >::type GetStaticTypeId( )
+	{
+		return Engine::GetInstance( )->GetMetaClassRegistry( )->GetTypeId< T >( );
+	}
+}
+
+#endif
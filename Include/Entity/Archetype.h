@@ -54,6 +54,12 @@ namespace Enjon
 			*/
 			EntityHandle Instantiate( const Transform& transform = Transform(), World* world = nullptr ); 
 
+			/**
+			* @brief Instantiates one instance per given transform. Walks the archetype hierarchy and reserves entity and component 
+			*		 storage once for all instances, so is much cheaper than calling Instantiate() for each.
+			*/
+			Vector< EntityHandle > InstantiateBatch( const Vector< Transform >& transforms, World* world = nullptr ); 
+
 			/**
 			* @brief
 			*/
@@ -91,6 +97,11 @@ namespace Enjon
 			*/
 			void RecursivelySetArchetype( const EntityHandle& handle );
 
+			/**
+			* @brief Appends entity and all of its descendants in pre-order
+			*/
+			void FlattenHierarchy( const EntityHandle& entity, Vector< Entity* >* out );
+
 			/**
 			* @brief
 			*/
@@ -104,7 +115,7 @@ namespace Enjon
 			/**
 			* @brief
 			*/
-			void RecursivelyFixInstancedEntities( const EntityHandle& dest, const HashMap< String, String >& uuidMap );
+			void RecursivelyFixInstancedEntities( const EntityHandle& dest, const HashMap< UUID, UUID >& uuidMap );
 
 			/**
 			* @brief
@@ -114,12 +125,12 @@ namespace Enjon
 			/**
 			* @brief
 			*/
-			void FillUUIDMap( const EntityHandle& entity, HashMap< String, String >* uuidMap ); 
+			void FillUUIDMap( const EntityHandle& entity, HashMap< UUID, UUID >* uuidMap ); 
 
 			/**
 			* @brief
 			*/
-			HashMap< String, String > ConstructUUIDMap( const EntityHandle& entity );
+			HashMap< UUID, UUID > ConstructUUIDMap( const EntityHandle& entity );
 
 		protected: 
 			Entity* mRoot = nullptr;
@@ -12,7 +12,7 @@ namespace Enjon
 	ENJON_CLASS( Construct )
 	class CameraComponent : public Component
 	{
-		ENJON_COMPONENT( CameraComponent )
+		ENJON_COMPONENT( CameraComponent, Reads[ Entity ] )
 
 		public:
 
@@ -10,7 +10,7 @@ namespace Enjon
 	ENJON_CLASS( )
 	class DirectionalLightComponent : public Component
 	{ 
-		ENJON_COMPONENT( DirectionalLightComponent )
+		ENJON_COMPONENT( DirectionalLightComponent, Reads[ Entity ] )
 
 		public:
 
@@ -57,7 +57,7 @@ namespace Enjon
 	ENJON_CLASS( )
 	class RigidBodyComponent : public Component
 	{
-		ENJON_COMPONENT( RigidBodyComponent )
+		ENJON_COMPONENT( RigidBodyComponent, Writes[ Entity ] )
 
 		public: 
 
@@ -252,6 +252,11 @@ namespace Enjon
 			*/
 			virtual Result DeserializeData( ByteBuffer* buffer ) override; 
 
+			/**
+			* @brief
+			*/
+			virtual Result CopyData( const Object* source ) override;
+
 			/**
 			* @brief
 			*/
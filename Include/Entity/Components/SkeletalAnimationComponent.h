@@ -12,6 +12,7 @@
 namespace Enjon
 { 
 	class AnimationSubsystem;
+	class SkeletalMeshComponent;
 
 	ENJON_CLASS( )
 	class SkeletalAnimationComponent : public Component
@@ -27,6 +28,12 @@ namespace Enjon
 			*/
 			void UpdateAndCalculateTransforms( ); 
 
+			/**
+			* @brief Calculates joint transforms into given skeletal mesh component's renderable. Only touches this component
+			*		 and the given mesh component, so can be called for separate entities concurrently.
+			*/
+			void UpdateAndCalculateTransforms( SkeletalMeshComponent* smc ); 
+
 			/**
 			* @brief
 			*/
@@ -34,14 +41,20 @@ namespace Enjon
 
 		private: 
 
-			ENJON_PROPERTY( )
+			// Instances of an archetype read animation and speed through to the archetype's component until they set their own
+
+			ENJON_PROPERTY( InstanceShared )
 			AssetHandle< SkeletalAnimation > mAnimation; 
 
 			ENJON_PROPERTY( NonSerializeable, ReadOnly )
 			f32 mCurrentAnimationTime = 0.0f; 
 
-			ENJON_PROPERTY( UIMin = 0.1f, UIMax = 10.0f )
+			ENJON_PROPERTY( InstanceShared, UIMin = 0.1f, UIMax = 10.0f )
 			f32 mAnimationSpeed = 1.0f; 
+
+			// Scratch for sampling joints each update, kept to avoid reallocating
+			TransformStream mJointTransforms;
+			Vector< Mat4x4 > mJointMatrices;
 	};
 }
 
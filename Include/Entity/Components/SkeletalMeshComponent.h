@@ -19,7 +19,7 @@ namespace Enjon
 		friend AnimationSubsystem;
 		friend SkeletalAnimationComponent;
 
-		ENJON_COMPONENT( SkeletalMeshComponent )
+		ENJON_COMPONENT( SkeletalMeshComponent, Reads[ Entity ] )
 
 		public:
 
@@ -138,6 +138,11 @@ namespace Enjon
 			*/
 			virtual Result DeserializeData( ByteBuffer* buffer ) override; 
 
+			/*
+			* @brief
+			*/
+			virtual Result CopyData( const Object* source ) override;
+
 		protected: 
 			
 			ENJON_PROPERTY( )
@@ -13,7 +13,7 @@ namespace Enjon
 	ENJON_CLASS( )
 	class StaticMeshComponent : public Component
 	{
-		ENJON_COMPONENT( StaticMeshComponent )
+		ENJON_COMPONENT( StaticMeshComponent, Reads[ Entity ] )
 
 		public:
 
@@ -142,12 +142,20 @@ namespace Enjon
 			*/
 			virtual Result DeserializeData( ByteBuffer* buffer ) override; 
 
+			/*
+			* @brief
+			*/
+			virtual Result CopyData( const Object* source ) override;
+
 		protected: 
 
 		private: 
 			
 			ENJON_PROPERTY( )
 			StaticMeshRenderable mRenderable;
+
+			// Entity transform version last pushed into renderable
+			u32 mTransformVersion = std::numeric_limits< u32 >::max( );
 	};
 }
 
@@ -21,13 +21,6 @@ namespace Enjon
 	class SpotLight;
 	class QuadBatch;
 
-	enum class RenderableSortType
-	{
-		MATERIAL,
-		DEPTH,
-		NONE
-	};
-
 	struct AmbientSettings
 	{
 		AmbientSettings()
@@ -89,6 +82,16 @@ namespace Enjon
 			*/
 			void RemoveNonDepthTestedStaticMeshRenderable( StaticMeshRenderable* renderable );
 
+			/*
+			* @brief Defers removals from the sorted renderable lists until EndBatchedRemoval( ), which compacts them in one pass
+			*/
+			void BeginBatchedRemoval( );
+
+			/*
+			* @brief Drops all renderables removed since BeginBatchedRemoval( ) from the sorted renderable lists
+			*/
+			void EndBatchedRemoval( );
+
 			/*
 			* @brief
 			*/
@@ -199,25 +202,6 @@ namespace Enjon
 			*/
 			void SetActiveCamera( Camera* camera );
 
-		private: 
-
-			/*
-			* @brief
-			*/
-			void SortStaticMeshRenderables( RenderableSortType type = RenderableSortType::MATERIAL );
-
-		private:
-
-			/*
-			* @brief
-			*/
-			static bool CompareMaterial(Renderable* a, Renderable* b);
-
-			/*
-			* @brief
-			*/
-			static bool CompareDepth(Renderable* a, Renderable* b);
-
 		private:
 
 			ENJON_PROPERTY( )
@@ -238,6 +222,9 @@ namespace Enjon
 			HashSet<SpotLight*> mSpotLights; 
 			AmbientSettings mAmbientSettings; 
 
+			// Sorted lists are compacted once at end of batch rather than on every removal
+			bool mBatchedRemoval = false;
+
 			// Not sure that I like this "solution"
 			Camera* mActiveCamera = nullptr;
 			Camera mDefaultCamera;
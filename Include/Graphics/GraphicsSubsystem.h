@@ -2,6 +2,7 @@
 #define ENJON_GRAPHICS_SUBSYSTEM_H
 
 #define MAX_DEBUG_LINES 100000
+#define RENDERABLE_CULLING_BATCH_SIZE 256
 
 #include "Defines.h"
 #include "System/Types.h"
@@ -13,6 +14,8 @@
 #include "Entity/EntityManager.h"
 #include "Base/SubsystemContext.h"
 #include "Graphics/GBuffer.h"
+#include "Graphics/RenderQueue.h"
+#include "Math/Frustum.h"
 #include "Subsystem.h" 
 
 namespace Enjon 
@@ -27,6 +30,17 @@ namespace Enjon
 	class ShaderUniform;
 	class World;
 
+	/**
+	* @brief Renderables of a context that passed frustum culling this frame, in scene submission order
+	*/
+	struct RenderVisibleSet
+	{
+		Vector< StaticMeshRenderable* > mStaticMeshRenderables;
+		Vector< SkeletalMeshRenderable* > mSkeletalMeshRenderables;
+		u32 mVisibleCount = 0;
+		u32 mCulledCount = 0;
+	};
+
 	ENJON_CLASS( )
 	class GraphicsSubsystemContext : public SubsystemContext
 	{
@@ -72,11 +86,20 @@ namespace Enjon
 			*/
 			void ReinitializeFrameBuffers( const iVec2& viewport );
 
+			/**
+			* @brief Renderables that survived the last culling stage of this context
+			*/
+			const RenderVisibleSet& GetVisibleSet( ) const;
+
 		protected: 
 			GraphicsScene mScene;
 			FrameBuffer* mBackBuffer = nullptr;	// Eventually will need to just have a rendertarget that can be used with a "global" framebuffer
 			FrameBuffer* mObjectIDBuffer = nullptr;
 			Mat4x4 mPreviousViewProjectionMatrix = Mat4x4::Identity( );
+			RenderVisibleSet mVisibleSet;
+			BoundsStream mCullingBounds;
+			Vector< u8 > mCullingVisibility;
+			RenderQueue mRenderQueue;
 	};
 
 	struct ToneMapSettings
@@ -279,6 +302,11 @@ namespace Enjon
 
 			void InitDebugDrawing( );
 
+			/**
+			* @brief Uploads camera and time data to the frame uniform buffer and binds it for shader graph shaders
+			*/
+			void UpdateFrameUniforms( const Camera* camera, const Mat4x4& previousViewProjection, const f32& worldTime );
+
 			void DebugDrawSubmit( GraphicsSubsystemContext* ctx );
 
 			/**
@@ -305,6 +333,12 @@ namespace Enjon
 			*@brief
 			*/
 			void GBufferPass( GraphicsSubsystemContext* ctx );
+
+			/**
+			* @brief Tests world bounds of every mesh renderable in the context's scene against the camera frustum and
+			*		 fills the context's visible set
+			*/
+			void CullRenderables( GraphicsSubsystemContext* ctx, const Camera* camera );
 			
 			/**
 			*@brief
@@ -438,6 +472,7 @@ namespace Enjon
 			BloomSettings mBloomSettings = BloomSettings(Vec3(0.384f, 0.366f, 0.500f), Vec3(3, 3, 2), Vec3(0.001f, 0.006f, 0.015f)); 
 
 			bool mShowGame = true;
+			bool mFrustumCullingEnabled = true;
 			bool mShowGraphicsOptionsWindow = true;
 			bool mShowStyles = true;
 
@@ -484,6 +519,8 @@ namespace Enjon
 			GLuint mDebugLineVAO; 
 			GLuint mDebugLineVBO; 
 
+			GLuint mFrameUniformBuffer = 0;
+
 			HashSet< GraphicsSubsystemContext* > mContexts;
 	};
 }
@@ -0,0 +1,106 @@
+// @file RenderQueue.h
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#pragma once
+#ifndef ENJON_RENDER_QUEUE_H
+#define ENJON_RENDER_QUEUE_H
+
+#include "Defines.h"
+#include "System/Types.h"
+
+namespace Enjon
+{
+	class Renderable;
+	class Material;
+	class SubMesh;
+	class Shader;
+	enum class ShaderPassType;
+
+	using RenderSortKey = u64;
+
+	/**
+	* @brief One draw of one submesh of a renderable in a given pass
+	*/
+	struct RenderCommand
+	{
+		Renderable* mRenderable = nullptr;
+		const Shader* mShader = nullptr;
+		const Material* mMaterial = nullptr;
+		const SubMesh* mSubMesh = nullptr;
+		u32 mSubMeshIndex = 0;
+		ShaderPassType mPass;
+	};
+
+	/**
+	* @brief Draw commands of one frame, ordered by a packed sort key so that consecutive commands share as much
+	*		 state as possible. Key layout, most significant bits first:
+	*
+	*		 pass ( 4 ) | shader ( 12 ) | material ( 16 ) | submesh ( 16 ) | depth ( 16 )
+	*
+	*		 Shaders, materials and submeshes are given dense slots in the order they're first pushed each frame. Slots
+	*		 past what a field can hold share its last value, which only costs extra state changes, never correctness.
+	*/
+	class RenderQueue
+	{
+		public:
+
+			/**
+			* @brief Constructor
+			*/
+			RenderQueue( ) = default;
+
+			/**
+			* @brief Destructor
+			*/
+			~RenderQueue( ) = default;
+
+			/**
+			* @brief Removes all commands and slot assignments, keeps allocated memory
+			*/
+			void Clear( );
+
+			/**
+			* @brief Adds command. Depth is distance to camera divided by far plane distance, clamped to [ 0, 1 ].
+			*/
+			void Push( const ShaderPassType& pass, const Shader* shader, const Material* material, const SubMesh* subMesh, Renderable* renderable, const u32& subMeshIndex, const f32& depth );
+
+			/**
+			* @brief Radix sorts commands by key. Commands with equal keys keep their push order.
+			*/
+			void Sort( );
+
+			/**
+			* @brief
+			*/
+			u32 GetCount( ) const;
+
+			/**
+			* @brief Command at index in sorted order
+			*/
+			const RenderCommand& GetCommand( const u32& index ) const;
+
+			/**
+			* @brief Key of command at index in sorted order
+			*/
+			RenderSortKey GetSortKey( const u32& index ) const;
+
+		private:
+
+			/**
+			* @brief Dense slot of object, clamped to fit in bits
+			*/
+			u32 GetSlot( HashMap< const void*, u32 >& slots, const void* object, const u32& bits );
+
+		private:
+			Vector< RenderCommand > mCommands;
+			Vector< RenderSortKey > mKeys;
+			Vector< u32 > mOrder;
+			Vector< RenderSortKey > mScratchKeys;
+			Vector< u32 > mScratchOrder;
+			HashMap< const void*, u32 > mShaderSlots;
+			HashMap< const void*, u32 > mMaterialSlots;
+			HashMap< const void*, u32 > mSubMeshSlots;
+	};
+}
+
+#endif
@@ -9,6 +9,7 @@
 #include "System/Types.h"
 #include "Defines.h"
 #include "Math/Maths.h"
+#include "Math/TransformStream.h"
 #include "Asset/Asset.h" 
 #include "Graphics/Mesh.h"
 
@@ -125,9 +126,16 @@ namespace Enjon
 		protected:
 
 			/*
-			* @brief
+			* @brief Samples every joint of animation at time into jointTransforms and converts them all to joint space
+			*		 matrices in one bulk pass
+			*/
+			void CalculateJointMatrices( const SkeletalAnimation* animation, const f32& time, TransformStream& jointTransforms, Vector< Mat4x4 >& outJointMatrices ) const;
+
+			/*
+			* @brief Walks joint hierarchy from jointID. Joint matrices come from CalculateJointMatrices( ), or are null
+			*		 for the bind pose.
 			*/
-			void CalculateTransform( const u32& jointID, const Mat4x4& parentMatrix, Vector<Mat4x4>& outMatrices, const SkeletalAnimation* animation, const f32& time ) const;
+			void CalculateTransform( const u32& jointID, const Mat4x4& parentMatrix, Vector<Mat4x4>& outMatrices, const Vector< Mat4x4 >* jointMatrices ) const;
 
 		protected: 
 			ENJON_PROPERTY( HideInEditor )
@@ -0,0 +1,117 @@
+// @file Bounds.h
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#pragma once
+#ifndef ENJON_BOUNDS_H
+#define ENJON_BOUNDS_H
+
+#include "Math/Vec3.h"
+#include "Math/Mat4.h"
+#include "System/Types.h"
+
+namespace Enjon
+{
+	class Frustum;
+
+	/**
+	* @brief Axis aligned bounding box. Default constructed bounds are empty and grow as points are added.
+	*/
+	class Bounds
+	{
+		public:
+
+			/**
+			* @brief Constructor, empty bounds
+			*/
+			Bounds( );
+
+			/**
+			* @brief Constructor
+			*/
+			Bounds( const Vec3& min, const Vec3& max );
+
+			/**
+			* @brief Destructor
+			*/
+			~Bounds( ) = default;
+
+			/**
+			* @brief Whether any point has been added
+			*/
+			bool IsValid( ) const;
+
+			/**
+			* @brief Grows bounds to contain point
+			*/
+			void Encapsulate( const Vec3& point );
+
+			/**
+			* @brief Grows bounds to contain other bounds
+			*/
+			void Encapsulate( const Bounds& other );
+
+			/**
+			* @brief
+			*/
+			Vec3 GetMin( ) const;
+
+			/**
+			* @brief
+			*/
+			Vec3 GetMax( ) const;
+
+			/**
+			* @brief
+			*/
+			Vec3 GetCenter( ) const;
+
+			/**
+			* @brief Half size along each axis
+			*/
+			Vec3 GetExtents( ) const;
+
+			/**
+			* @brief Axis aligned bounds containing these bounds after being transformed by matrix
+			*/
+			Bounds TransformedBy( const Mat4x4& matrix ) const;
+
+		private:
+			Vec3 mMin;
+			Vec3 mMax;
+	};
+
+	/**
+	* @brief Many bounds stored as separate center and extent arrays, so four boxes can be tested against a plane at once
+	*/
+	class BoundsStream
+	{
+		friend Frustum;
+
+		public:
+
+			/**
+			* @brief Resizes stream, new entries are never culled
+			*/
+			void Resize( const u32& count );
+
+			/**
+			* @brief
+			*/
+			u32 GetCount( ) const;
+
+			/**
+			* @brief Writes bounds at index. Invalid bounds are stored so that they are never culled.
+			*/
+			void Set( const u32& index, const Bounds& bounds );
+
+		private:
+			Vector< f32 > mCenterX;
+			Vector< f32 > mCenterY;
+			Vector< f32 > mCenterZ;
+			Vector< f32 > mExtentX;
+			Vector< f32 > mExtentY;
+			Vector< f32 > mExtentZ;
+	};
+}
+
+#endif
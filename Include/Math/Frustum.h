@@ -0,0 +1,53 @@
+// @file Frustum.h
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#pragma once
+#ifndef ENJON_FRUSTUM_H
+#define ENJON_FRUSTUM_H
+
+#include "Math/Bounds.h"
+#include "Math/Mat4.h"
+#include "System/Types.h"
+
+namespace Enjon
+{
+	/**
+	* @brief Six planes of a view frustum, extracted from a view projection matrix
+	*/
+	class Frustum
+	{
+		public:
+
+			/**
+			* @brief Constructor, frustum that contains everything
+			*/
+			Frustum( );
+
+			/**
+			* @brief Constructor
+			*/
+			Frustum( const Mat4x4& viewProjection );
+
+			/**
+			* @brief Destructor
+			*/
+			~Frustum( ) = default;
+
+			/**
+			* @brief Whether bounds are at least partially inside the frustum. Invalid bounds always are.
+			*/
+			bool Intersects( const Bounds& bounds ) const;
+
+			/**
+			* @brief Tests bounds[ begin, end ) against the frustum, writing 1 to outVisible[ i ] for every bounds at least
+			*		 partially inside and 0 otherwise. Tests four bounds at a time with SSE.
+			*/
+			void CullBounds( const BoundsStream& bounds, const u32& begin, const u32& end, u8* outVisible ) const;
+
+		private:
+			// Plane i is mPlanes[ i ] * x + mPlanes[ i + 6 ] * y + mPlanes[ i + 12 ] * z + mPlanes[ i + 18 ] >= 0 inside
+			f32 mPlanes[ 24 ];
+	};
+}
+
+#endif
@@ -151,6 +151,16 @@ namespace Enjon
 			*/
 			void RemoveFromContactEvents( RigidBodyComponent* comp );
 
+			/**
+			*@brief Defers scrubbing removed components out of other components' contact sets until EndBatchedRemoval( )
+			*/
+			void BeginBatchedRemoval( );
+
+			/**
+			*@brief Scrubs all components removed since BeginBatchedRemoval( ) from contact sets in a single pass
+			*/
+			void EndBatchedRemoval( );
+
 			/**
 			*@brief
 			*/
@@ -198,6 +208,8 @@ namespace Enjon
 			HashSet<RigidBody*> mRigidBodies;
 			HashMap< RigidBodyComponent*, HashSet< RigidBodyComponent* > > mContactEvents;
 			HashMap< RigidBodyComponent*, HashSet< RigidBodyComponent* > > mNewContactEvents;
+			HashSet< RigidBodyComponent* > mPendingContactRemovals;
+			bool mBatchedRemoval = false;
 
 			PhysicsDebugDrawer mDebugDrawer;
 
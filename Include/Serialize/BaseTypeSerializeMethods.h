@@ -22,6 +22,19 @@ namespace Enjon
 			* @brief
 			*/
 			static void Deserialize( const Object* object, ByteBuffer* buffer );
+
+			/**
+			* @brief Copies property from source into dest object of the same class. Gives the same result as serializing 
+			*		 the property from source and deserializing it into dest, without the buffer round trip for values and arrays.
+			*/
+			static void Copy( const Object* source, const Object* dest, const MetaProperty* property );
+
+		private:
+
+			/**
+			* @brief Copies property by serializing it from source and deserializing it into dest
+			*/
+			static void CopyArchived( const Object* source, const Object* dest, const MetaProperty* property );
 	};
 
 }
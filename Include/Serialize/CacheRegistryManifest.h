@@ -81,7 +81,7 @@ namespace Enjon
 
 		private:
 			String mManifestPath; 
-			HashMap< String, CacheManifestRecord > mManifestRecords;
+			HashMap< UUID, CacheManifestRecord > mManifestRecords;
 			const AssetManager* mAssetManager = nullptr;
 	};
 }
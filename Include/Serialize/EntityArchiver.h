@@ -61,6 +61,13 @@ namespace Enjon
 			*/
 			static EntityHandle Deserialize( ByteBuffer* buffer, World* world, bool isInstanced = false );
 
+			/*
+			* @brief Static method which clones entity hierarchy into specific world directly through reflection. Gives the same result as 
+			*		 serializing the entity and deserializing it again, except that every cloned entity is given a new UUID. If given, 
+			*		 all cloned entities are appended to clonedEntities in hierarchy pre-order.
+			*/
+			static EntityHandle Clone( const EntityHandle& source, World* world, bool isInstanced = false, Vector< Entity* >* clonedEntities = nullptr );
+
 		protected:
 
 			/*
@@ -68,6 +75,17 @@ namespace Enjon
 			*/
 			static EntityHandle DeserializeInternal( const EntityHandle& entiy, ByteBuffer* buffer, World* world, bool isInstanced = false );
 
+			/*
+			* @brief
+			*/
+			static EntityHandle CloneInternal( Entity* source, const EntityHandle& entity, World* world, bool isInstanced, Vector< Entity* >* clonedEntities );
+
+			/*
+			* @brief Links components of entity back to its prototype's components for InstanceShared properties, unless one 
+			*		 of those is overridden. Links aren't serialized, so they're restored once overrides have been recorded.
+			*/
+			static void RelinkSharedComponents( Entity* entity );
+
 		private: 
 	};
 
@@ -90,6 +90,12 @@ namespace Enjon
 			*/ 
 			static Result Deserialize( ByteBuffer* bufer, Object* object );
 
+			/*
+			*@brief Copies all data from source into dest object of the same class directly, without going through a buffer. Same
+			*		result as serializing source and deserializing into dest.
+			*/ 
+			static Result Copy( const Object* source, Object* dest );
+
 		protected:
 
 			/*
@@ -157,6 +163,12 @@ namespace Enjon
 			*/ 
 			static Result DeserializeObjectDataDefault( const Object* object, const MetaClass* cls, ByteBuffer* buffer ); 
 
+			/*
+			*@brief Copies all serializable properties. Instances reading InstanceShared properties through to their source
+			*		can skip those.
+			*/ 
+			static Result CopyObjectDataDefault( const Object* source, const Object* dest, const MetaClass* cls, bool skipInstanceShared = false ); 
+
 			/*
 			*@brief
 			*/ 
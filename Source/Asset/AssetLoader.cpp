@@ -198,7 +198,7 @@ namespace Enjon
 		if ( Exists( id ) )
 		{
 			// Need to check for loaded status here
-			AssetRecordInfo* info = &mAssetsByUUID[id.ToString( )];
+			AssetRecordInfo* info = &mAssetsByUUID[id];
 
 			// If unloaded, load asset from disk
 			if ( info->GetAssetLoadStatus( ) == AssetLoadStatus::Unloaded )
@@ -344,7 +344,7 @@ namespace Enjon
 
 	bool AssetLoader::Exists( UUID uuid ) const
 	{
-		auto query = mAssetsByUUID.find( uuid.ToString( ) );
+		auto query = mAssetsByUUID.find( uuid );
 		if ( query != mAssetsByUUID.end( ) )
 		{
 			return true;
@@ -377,15 +377,15 @@ namespace Enjon
 		// If the UUID exists for whatever reason, return that asset
 		if ( info.mAsset->mUUID && Exists( info.mAsset->GetUUID( ) ) )
 		{
-			return mAssetsByUUID[info.mAsset->GetUUID( ).ToString( )].mAsset;
+			return mAssetsByUUID[info.mAsset->GetUUID( )].mAsset;
 		}
 
 		// Add asset
-		mAssetsByUUID[info.mAsset->GetUUID( ).ToString( )] = info;
-		mAssetsByName[info.mAsset->GetName( )] = &mAssetsByUUID[info.mAsset->GetUUID( ).ToString( )];
+		mAssetsByUUID[info.mAsset->GetUUID( )] = info;
+		mAssetsByName[info.mAsset->GetName( )] = &mAssetsByUUID[info.mAsset->GetUUID( )];
 
 		// Set info for asset
-		info.mAsset->mRecordInfo = &mAssetsByUUID[info.mAsset->GetUUID( ).ToString( )];
+		info.mAsset->mRecordInfo = &mAssetsByUUID[info.mAsset->GetUUID( )];
 
 		return info.mAsset;
 	}
@@ -409,9 +409,9 @@ namespace Enjon
 		if ( !Exists( record.mAssetUUID ) )
 		{
 			// Store record by UUID
-			mAssetsByUUID[record.mAssetUUID.ToString( )] = info;
+			mAssetsByUUID[record.mAssetUUID] = info;
 			// Store pointer to record by asset name
-			mAssetsByName[record.mAssetName] = &mAssetsByUUID[record.mAssetUUID.ToString( )];
+			mAssetsByName[record.mAssetName] = &mAssetsByUUID[record.mAssetUUID];
 
 			return Result::SUCCESS;
 		}
@@ -444,8 +444,8 @@ namespace Enjon
 		// Reassign engine asset records
 		for ( auto& rec : mEngineAssetRecords )
 		{
-			mAssetsByUUID[rec.mAssetUUID.ToString( )] = rec;
-			mAssetsByName[rec.mAssetName] = &mAssetsByUUID[rec.mAssetUUID.ToString( )];
+			mAssetsByUUID[rec.mAssetUUID] = rec;
+			mAssetsByName[rec.mAssetName] = &mAssetsByUUID[rec.mAssetUUID];
 		}
 	}
 
@@ -454,7 +454,7 @@ namespace Enjon
 	void AssetLoader::RenameAssetFilePath( Asset* asset, const String& path )
 	{
 		// Grab the record info for this asset
-		AssetRecordInfo* info = &mAssetsByUUID[asset->GetUUID( ).ToString( )];
+		AssetRecordInfo* info = &mAssetsByUUID[asset->GetUUID( )];
 
 		// Set info file path
 		info->mAssetFilePath = path;
@@ -248,7 +248,7 @@ namespace Enjon
 
 	//============================================================================================ 
 
-	const HashMap< Enjon::String, AssetRecordInfo >* AssetManager::GetAssets( const Enjon::MetaClass* cls ) const
+	const HashMap< UUID, AssetRecordInfo >* AssetManager::GetAssets( const Enjon::MetaClass* cls ) const
 	{
 		// Make sure class is valid
 		assert( cls != nullptr );
@@ -1088,7 +1088,7 @@ namespace Enjon
 			if ( mShowAnimationCreateDialogue && !mShowSkeletonCreateDialogue )   // However this would work...
 			{
 				// Grab all skeletons in database
-				HashMap< String, AssetRecordInfo >* skeletons = EngineSubsystem( AssetManager )->GetAssets< Skeleton >();	
+				HashMap< UUID, AssetRecordInfo >* skeletons = EngineSubsystem( AssetManager )->GetAssets< Skeleton >();	
 
 				// Drop down box for these...
 				for ( auto& s : skeletons )
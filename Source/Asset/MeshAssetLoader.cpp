@@ -162,6 +162,8 @@ namespace Enjon
 		sm->mDrawType = GL_TRIANGLES;
 		// Set draw count
 		sm->mDrawCount = sm->mVertexData.GetSize( ) / vertDecl.GetSizeInBytes( ); 
+		// Set bounds for culling
+		sm->CalculateBounds( );
 		// Set mesh name
 		mesh->mName = "DefaultMesh"; 
 
@@ -503,6 +505,8 @@ namespace Enjon
 
 		// Set draw count
 		sm->mDrawCount = sm->mVertexData.GetSize( ) / vertDecl.GetSizeInBytes( ); 
+		// Set bounds for culling
+		sm->CalculateBounds( );
 	}
 
 	//=====================================================================================================
@@ -601,7 +605,7 @@ namespace Enjon
 			if ( ImGui::BeginCombo( "##skeletons", ( mSkeletonAsset ? mSkeletonAsset->GetName() : "Skeleton..." ).c_str( ) ) )
 			{
 				// Grab all skeletons in database
-				const HashMap< String, AssetRecordInfo >* skeletons = EngineSubsystem( AssetManager )->GetAssets< Skeleton >();	
+				const HashMap< UUID, AssetRecordInfo >* skeletons = EngineSubsystem( AssetManager )->GetAssets< Skeleton >();	
 
 				if ( skeletons )
 				{
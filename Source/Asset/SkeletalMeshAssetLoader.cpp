@@ -333,6 +333,8 @@ namespace Enjon
 
 		// Set draw count
 		sm->mDrawCount = sm->mVertexData.GetSize( ) / vertDecl.GetSizeInBytes( ); 
+		// Set bounds for culling
+		sm->CalculateBounds( );
 	} 
 
 	//===================================================================================
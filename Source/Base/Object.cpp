@@ -33,6 +33,13 @@ namespace Enjon
 
 	//=========================================================================
 
+	Result Object::CopyData( const Object* source )
+	{
+		return Result::INCOMPLETE;
+	}
+
+	//=========================================================================
+
 	bool MetaClass::InstanceOf( const MetaClass* cls ) const
 	{
 		return ( cls && cls == this );
@@ -175,6 +182,13 @@ namespace Enjon
 
 	//====================================================================================== 
 
+	const Object* Object::GetPropertySource( const MetaProperty* prop ) const
+	{
+		return this;
+	}
+
+	//====================================================================================== 
+
 	Result Object::RecordPropertyOverrides( Object* source )
 	{
 		return Result::INCOMPLETE;
@@ -13,6 +13,7 @@
 #include "Physics/PhysicsSubsystem.h"
 #include "Graphics/AnimationSubsystem.h"
 #include "Scene/SceneManager.h"
+#include "System/JobSystem.h"
 #include "Utils/Timing.h"
 #include "SubsystemCatalog.h"
 #include "Base/World.h"
@@ -176,6 +177,7 @@ namespace Enjon
 		mAssetManager		= mSubsystemCatalog->Register< AssetManager >( false );		// Will do manual initialization of asset management system, since it's project dependent 
 		mGraphics			= mSubsystemCatalog->Register< GraphicsSubsystem >( ); 
 		mInput				= mSubsystemCatalog->Register< Input >( ); 
+		mJobSystem			= mSubsystemCatalog->Register< JobSystem >( );
 		mEntities			= mSubsystemCatalog->Register< EntityManager >( );
 		mPhysics			= mSubsystemCatalog->Register< PhysicsSubsystem >( );
 		mSceneManager		= mSubsystemCatalog->Register< SceneManager >( );
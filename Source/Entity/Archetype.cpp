@@ -43,7 +43,7 @@ namespace Enjon
 
 	//=======================================================================================
 
-	void Archetype::FillUUIDMap( const EntityHandle& entity, HashMap< String, String >* uuidMap )
+	void Archetype::FillUUIDMap( const EntityHandle& entity, HashMap< UUID, UUID >* uuidMap )
 	{
 		Entity* ent = entity.Get( );
 
@@ -55,7 +55,7 @@ namespace Enjon
 		// Insert into map
 		if ( ent->HasPrototypeEntity( ) )
 		{
-			uuidMap->insert( std::pair<String, String>( ent->GetUUID().ToString( ), ent->GetPrototypeEntity( ).Get( )->GetUUID( ).ToString( ) ) );
+			uuidMap->insert( std::pair<UUID, UUID>( ent->GetUUID(), ent->GetPrototypeEntity( ).Get( )->GetUUID( ) ) );
 		} 
 
 		// Do all children
@@ -67,16 +67,16 @@ namespace Enjon
 
 	//=======================================================================================
 
-	HashMap< String, String > Archetype::ConstructUUIDMap( const EntityHandle& entity )
+	HashMap< UUID, UUID > Archetype::ConstructUUIDMap( const EntityHandle& entity )
 	{ 
-		HashMap< String, String > uuidMap; 
+		HashMap< UUID, UUID > uuidMap; 
 		FillUUIDMap( entity, &uuidMap ); 
 		return uuidMap;
 	}
 
 	//=======================================================================================
 
-	void Archetype::RecursivelyFixInstancedEntities( const EntityHandle& dest, const HashMap< String, String >& uuidMap )
+	void Archetype::RecursivelyFixInstancedEntities( const EntityHandle& dest, const HashMap< UUID, UUID >& uuidMap )
 	{ 
 		Entity* ent = dest.Get( );
 
@@ -93,9 +93,10 @@ namespace Enjon
 		}
 
 		// Found uuid in map, so fix up prototype entity pointer
-		if ( uuidMap.find( ent->GetUUID( ).ToString( ) ) != uuidMap.end( ) )
+		auto query = uuidMap.find( ent->GetUUID( ) );
+		if ( query != uuidMap.end( ) )
 		{
-			ent->SetPrototypeEntity( EngineSubsystem( EntityManager )->GetEntityByUUID( UUID( uuidMap.at(  ent->GetUUID( ).ToString( ) ) ) ) );
+			ent->SetPrototypeEntity( EngineSubsystem( EntityManager )->GetEntityByUUID( query->second ) );
 		}
 
 		// Fix all children
@@ -253,7 +254,10 @@ namespace Enjon
 
 		// Reset all the important things
 		Entity* copy = rootCopy.Get( );
-		copy->mInstancedEntities = mRoot->mInstancedEntities;
+		if ( mRoot->mColdData )
+		{
+			copy->GetColdData( )->mInstancedEntities = mRoot->mColdData->mInstancedEntities;
+		}
 		copy->mUUID = mRoot->mUUID;
 		copy->SetLocalTransform( transform );
 
@@ -314,9 +318,12 @@ namespace Enjon
 			EntityManager* em = EngineSubsystem( EntityManager );
 			EntityHandle newRoot = em->CopyEntity( entity, entity.Get( )->GetWorld( )->ConstCast< World >( ) );
 			Entity* nr = newRoot.Get( );
-			nr->mInstancedEntities = mRoot->mInstancedEntities;
+			if ( mRoot->mColdData )
+			{
+				nr->GetColdData( )->mInstancedEntities = mRoot->mColdData->mInstancedEntities;
+			}
 			nr->mUUID = mRoot->mUUID; 
-			nr->mArchetype = mRoot->mArchetype;
+			nr->SetArchetype( mRoot->GetArchetype( ) );
 
 			// Destroy previous entity
 			RecursivelyRemoveFromRoot( mRoot );
@@ -346,6 +353,25 @@ namespace Enjon
 
 	//=======================================================================================
 
+	void Archetype::FlattenHierarchy( const EntityHandle& entity, Vector< Entity* >* out )
+	{
+		Entity* ent = entity.Get( );
+
+		if ( !ent )
+		{
+			return;
+		}
+
+		out->push_back( ent );
+
+		for ( auto& c : ent->GetChildren( ) )
+		{
+			FlattenHierarchy( c, out );
+		}
+	}
+
+	//=======================================================================================
+
 	EntityHandle Archetype::Instantiate( const Transform& transform, World* world ) 
 	{ 
 		// If world isn't given, then get default world from engine
@@ -372,6 +398,85 @@ namespace Enjon
 
 	//=======================================================================================
 
+	Vector< EntityHandle > Archetype::InstantiateBatch( const Vector< Transform >& transforms, World* world )
+	{
+		Vector< EntityHandle > instances;
+
+		// Nothing to instantiate
+		if ( !mRoot || transforms.empty( ) )
+		{
+			return instances;
+		}
+
+		// If world isn't given, then get default world from engine
+		if ( !world )
+		{
+			world = Engine::GetInstance( )->GetWorld( );
+		} 
+
+		EntityManager* em = EngineSubsystem( EntityManager );
+
+		// Walk template hierarchy once. Clones are created in the same pre-order, so template entity i is the prototype of cloned entity i.
+		Vector< Entity* > templateEntities;
+		FlattenHierarchy( mRoot, &templateEntities );
+
+		// Count components of each type in a single instance
+		HashMap< const MetaClass*, u32 > componentCounts;
+		for ( auto& e : templateEntities )
+		{
+			for ( auto& c : e->GetComponents( ) )
+			{
+				componentCounts[ c->Class( ) ]++;
+			}
+		}
+
+		// Reserve storage for all instances up front
+		u32 instanceCount = ( u32 )transforms.size( );
+		em->ReserveEntities( ( u32 )templateEntities.size( ) * instanceCount );
+		for ( auto& cc : componentCounts )
+		{
+			em->ReserveComponents( cc.first, cc.second * instanceCount );
+		}
+
+		instances.reserve( instanceCount );
+
+		Vector< Entity* > cloned;
+		cloned.reserve( templateEntities.size( ) );
+
+		for ( auto& transform : transforms )
+		{
+			// Instance this entity
+			cloned.clear( );
+			EntityHandle instanced = EntityArchiver::Clone( mRoot, world, true, &cloned );
+
+			// Set prototype and archetype of every cloned entity in one pass
+			for ( usize i = 0; i < cloned.size( ); ++i )
+			{
+				Entity* dest = cloned[ i ];
+
+				if ( dest->HasPrototypeEntity( ) )
+				{
+					dest->RemovePrototypeEntity( );
+				}
+
+				dest->SetPrototypeEntity( templateEntities[ i ] );
+				dest->SetArchetype( this );
+			}
+
+			// Set transform for entity
+			instanced.Get( )->SetLocalTransform( transform ); 
+
+			// Clear all property overrides
+			ObjectArchiver::ClearAllPropertyOverrides( instanced.Get( ) );
+
+			instances.push_back( instanced );
+		}
+
+		return instances;
+	}
+
+	//=======================================================================================
+
 	bool Archetype::RecursivelySearchForArchetypeInstance( const AssetHandle< Archetype >& archetype, const EntityHandle& entity )
 	{
 		Entity* ent = entity.Get( );
@@ -385,7 +490,7 @@ namespace Enjon
 		bool found = false;
 
 		// The entity belongs to this archetype, therefore exists in hierachy
-		if ( entity.Get( )->mArchetype == archetype )
+		if ( entity.Get( )->GetArchetype( ) == archetype )
 		{
 			return true;
 		}
@@ -397,9 +502,9 @@ namespace Enjon
 		}
 
 		// If an archetype exists for this entity and it wasn't the provided archetype, need to check it 
-		if ( entity.Get( )->mArchetype )
+		if ( entity.Get( )->GetArchetype( ).IsValid( ) )
 		{
-			found |= ent->mArchetype.Get( )->ConstCast< Archetype >( )->ExistsInHierachy( archetype );
+			found |= ent->GetArchetype( ).Get( )->ConstCast< Archetype >( )->ExistsInHierachy( archetype );
 		}
 
 		return found; 
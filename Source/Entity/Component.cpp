@@ -4,22 +4,267 @@
 #include "Base/World.h"
 #include "Engine.h"
 #include "Application.h"
+#include "Serialize/BaseTypeSerializeMethods.h"
+
+#include <algorithm>
+#include <cstddef>
 
 namespace Enjon 
 { 
 	
 	//=========================================================================
 
-	ComponentArray::ComponentArray( )
+	const u32 ComponentArray::InvalidSlot;
+	
+	//=========================================================================
+
+	// Returns stride of component in chunked storage, 0 if class cannot be stored contiguously
+	INTERNAL usize GetChunkedStride( const MetaClass* cls )
+	{
+		// Only able to store contiguously if class has reflected size information and fits default allocation alignment
+		if ( cls && cls->CanPlacementConstruct( ) && cls->GetTypeAlignment( ) <= alignof( std::max_align_t ) )
+		{
+			usize align = std::max< usize >( cls->GetTypeAlignment( ), 1 );
+			return ( ( cls->GetTypeSize( ) + align - 1 ) / align ) * align;
+		}
+
+		return 0;
+	}
+	
+	//=========================================================================
+
+	ComponentArray::ComponentArray( const MetaClass* cls )
+		: mClass( cls ), mPool( GetChunkedStride( cls ) )
 	{ 
+		mStorageMode = mPool.GetStride( ) ? ComponentStorageMode::Chunked : ComponentStorageMode::Heap;
+
 	}
 	
 	//=========================================================================
 
 	ComponentArray::~ComponentArray( )
 	{
-		mComponentMap.clear( );
-		mComponentPtrs.clear( );
+		// Pool releases all chunk memory
+		mEntitySlots.clear( );
+		mSlotComponents.clear( );
+		mSlotEntities.clear( );
+	}
+
+	//=========================================================================
+
+	Component* ComponentArray::AddComponent( const MetaClass* cls, const u32& entityId )
+	{
+		// If already available then return component that's already allocated
+		Component* existing = GetComponent( entityId );
+		if ( existing )
+		{
+			return existing;
+		}
+
+		assert( cls == mClass );
+
+		u32 slot = mPool.Allocate( );
+
+		// Grow slot tables if pool handed out a new slot
+		if ( slot >= mSlotComponents.size( ) )
+		{
+			mSlotComponents.resize( slot + 1, nullptr );
+			mSlotEntities.resize( slot + 1, INVALID_ENTITY_ID );
+			mSlotVersions.resize( slot + 1, 0 );
+			mSlotTickLists.resize( slot + 1, InvalidSlot );
+			mSlotTickEntries.resize( slot + 1, 0 );
+		}
+
+		Component* component = nullptr;
+		switch ( mStorageMode )
+		{
+			case ComponentStorageMode::Chunked:
+			{
+				component = ( Component* )cls->PlacementConstruct( mPool.GetMemory( slot ) );
+			} break;
+
+			default:
+			case ComponentStorageMode::Heap:
+			{
+				component = ( Component* )cls->Construct( );
+			} break;
+		}
+
+		// Failed to construct, so give slot back
+		if ( !component )
+		{
+			mPool.Free( slot );
+			return nullptr;
+		}
+
+		component->mStorageSlot = slot;
+		mSlotComponents[ slot ] = component;
+		mSlotEntities[ slot ] = entityId;
+		if ( entityId >= mEntitySlots.size( ) )
+		{
+			// Sparse set grows a storage page at a time, following the entity id range in use
+			mEntitySlots.resize( ( entityId / ENTITY_PAGE_SIZE + 1 ) * ENTITY_PAGE_SIZE, InvalidSlot );
+		}
+		mEntitySlots[ entityId ] = slot;
+		mCount++;
+
+		// Entity and world aren't set up yet, so it's filed into a tick list at next update
+		mPendingTickSlots.push_back( slot );
+
+		// New components count as changed
+		MarkChanged( component );
+
+		return component;
+	}
+
+	//=========================================================================
+
+	void ComponentArray::DestructComponent( Component* component )
+	{
+		switch ( mStorageMode )
+		{
+			case ComponentStorageMode::Chunked:
+			{
+				// Memory is owned by pool, so only destruct
+				component->~Component( );
+			} break;
+
+			default:
+			case ComponentStorageMode::Heap:
+			{
+				delete component;
+			} break;
+		}
+	}
+
+	//=========================================================================
+
+	void ComponentArray::FreeComponent( Component* component )
+	{
+		if ( !component )
+		{
+			return;
+		}
+
+		u32 slot = component->mStorageSlot;
+		assert( slot < mSlotComponents.size( ) && mSlotComponents[ slot ] == component );
+
+		// Make sure it's unlinked from its entity
+		if ( mSlotEntities[ slot ] != INVALID_ENTITY_ID )
+		{
+			RemoveComponent( mSlotEntities[ slot ] );
+		}
+
+		// Instances still reading through to this component need their own copies now
+		component->ReleaseSharedData( true );
+
+		DestructComponent( component );
+
+		mSlotComponents[ slot ] = nullptr;
+		mPool.Free( slot );
+	}
+
+	//=========================================================================
+
+	void ComponentArray::ReleaseAll( )
+	{
+		// Walk slots linearly, destructing anything still alive
+		for ( u32 slot = 0; slot < mSlotComponents.size( ); ++slot )
+		{
+			Component* component = mSlotComponents[ slot ];
+			if ( !component )
+			{
+				continue;
+			}
+
+			// Unlink from sparse set
+			u32 entityId = mSlotEntities[ slot ];
+			if ( entityId != INVALID_ENTITY_ID )
+			{
+				mEntitySlots[ entityId ] = InvalidSlot;
+			}
+
+			// Sources and their instances are always the same class, so they're all going away together
+			component->mBase = nullptr;
+			component->ReleaseSharedData( false );
+			DestructComponent( component );
+		}
+
+		mSlotComponents.clear( );
+		mSlotEntities.clear( );
+		mSlotVersions.clear( );
+		mCount = 0;
+		mTickLists.clear( );
+		mSlotTickLists.clear( );
+		mSlotTickEntries.clear( );
+		mPendingTickSlots.clear( );
+		mTickEntryCount = 0;
+		mDeadTickEntryCount = 0;
+
+		// Hand all slots back to pool at once
+		mPool.ReleaseAll( );
+	}
+
+	//=========================================================================
+
+	void ComponentArray::Reserve( const u32& count, const u32& entityCapacity )
+	{
+		mPool.Reserve( count );
+
+		// Slot tables only grow when the pool hands out new slots, which is at most count more
+		mSlotComponents.reserve( mPool.GetSlotCount( ) + count );
+		mSlotEntities.reserve( mPool.GetSlotCount( ) + count );
+		mSlotVersions.reserve( mPool.GetSlotCount( ) + count );
+		mSlotTickLists.reserve( mPool.GetSlotCount( ) + count );
+		mSlotTickEntries.reserve( mPool.GetSlotCount( ) + count );
+
+		if ( entityCapacity > mEntitySlots.size( ) )
+		{
+			mEntitySlots.resize( entityCapacity, InvalidSlot );
+		}
+	}
+
+	//=========================================================================
+
+	void ComponentArray::MarkChanged( Component* component )
+	{
+		u32 slot = component->mStorageSlot;
+		assert( slot < mSlotVersions.size( ) && mSlotComponents[ slot ] == component );
+
+		// Only counted once per version. Separate slots can be stamped from different jobs, hence the atomic count.
+		if ( mSlotVersions[ slot ] != mChangeVersion )
+		{
+			mSlotVersions[ slot ] = mChangeVersion;
+			mChangedCount.fetch_add( 1, std::memory_order_relaxed );
+		}
+	}
+
+	//=========================================================================
+
+	void ComponentArray::AdvanceChangeVersion( )
+	{
+		mLastChangeStats.mVersion = mChangeVersion;
+		mLastChangeStats.mChanged = mChangedCount.exchange( 0, std::memory_order_relaxed );
+		mLastChangeStats.mTotal = mCount;
+		mChangeVersion++;
+	}
+
+	//=========================================================================
+
+	Vector<Component*> ComponentArray::GetComponents( )
+	{
+		Vector<Component*> components;
+		components.reserve( mCount );
+
+		for ( u32 slot = 0; slot < mSlotComponents.size( ); ++slot )
+		{
+			if ( mSlotEntities[ slot ] != INVALID_ENTITY_ID )
+			{
+				components.push_back( mSlotComponents[ slot ] );
+			}
+		}
+
+		return components;
 	}
 
 	//=========================================================================
@@ -52,6 +297,206 @@ namespace Enjon
 	
 	//=========================================================================
 
+	void Component::MarkChanged( )
+	{
+		if ( mBase )
+		{
+			mBase->MarkChanged( this );
+		}
+	}
+	
+	//=========================================================================
+
+	void Component::RefreshTickEntry( )
+	{
+		if ( mBase )
+		{
+			mBase->RefreshTickEntry( this );
+		}
+	}
+	
+	//=========================================================================
+
+	const Object* Component::GetPropertySource( const MetaProperty* prop ) const
+	{
+		if ( mSharedSource && prop && prop->HasFlags( MetaPropertyFlags::InstanceShared ) )
+		{
+			return mSharedSource;
+		}
+
+		return this;
+	}
+	
+	//=========================================================================
+
+	bool Component::SetSharedSource( const Component* source )
+	{
+		UnlinkSharedSource( );
+
+		// Always read from the component actually holding the values
+		if ( source && source->mSharedSource )
+		{
+			source = source->mSharedSource;
+		}
+
+		if ( !source || source == this || source->Class( ) != Class( ) )
+		{
+			return false;
+		}
+
+		// Nothing to share
+		const MetaClass* cls = Class( );
+		bool hasShared = false;
+		for ( usize i = 0; i < cls->GetPropertyCount( ) && !hasShared; ++i )
+		{
+			const MetaProperty* prop = cls->GetProperty( i );
+			hasShared = ( prop && prop->HasFlags( MetaPropertyFlags::InstanceShared ) );
+		}
+
+		if ( !hasShared )
+		{
+			return false;
+		}
+
+		// Source needs to know about its instances so they can take copies before it goes away
+		Component* owner = const_cast< Component* >( source );
+		if ( !owner->mSharedInstances )
+		{
+			owner->mSharedInstances = new Vector< Component* >( );
+		}
+
+		mSharedInstanceIndex = ( u32 )owner->mSharedInstances->size( );
+		owner->mSharedInstances->push_back( this );
+		mSharedSource = source;
+
+		return true;
+	}
+	
+	//=========================================================================
+
+	void Component::DetachSharedSource( const MetaProperty* writtenProp )
+	{
+		const Component* source = mSharedSource;
+		if ( !source )
+		{
+			return;
+		}
+
+		// Take copies of everything read through to source so far
+		const MetaClass* cls = Class( );
+		for ( usize i = 0; i < cls->GetPropertyCount( ); ++i )
+		{
+			const MetaProperty* prop = cls->GetProperty( i );
+			if ( prop && prop->HasFlags( MetaPropertyFlags::InstanceShared ) )
+			{
+				PropertyArchiver::Copy( source, this, prop );
+			}
+		}
+
+		// Written value diverges from the source from here on
+		if ( writtenProp )
+		{
+			const_cast< MetaProperty* >( writtenProp )->AddOverride( this, source );
+		}
+
+		UnlinkSharedSource( );
+	}
+	
+	//=========================================================================
+
+	void Component::DetachSharedSourceAtOffset( const usize& writtenOffset )
+	{
+		const MetaClass* cls = Class( );
+		for ( usize i = 0; i < cls->GetPropertyCount( ); ++i )
+		{
+			const MetaProperty* prop = cls->GetProperty( i );
+			if ( prop && prop->GetOffset( ) == writtenOffset && prop->HasFlags( MetaPropertyFlags::InstanceShared ) )
+			{
+				DetachSharedSource( prop );
+				return;
+			}
+		}
+
+		DetachSharedSource( );
+	}
+	
+	//=========================================================================
+
+	void Component::UnlinkSharedSource( )
+	{
+		if ( !mSharedSource )
+		{
+			return;
+		}
+
+		Vector< Component* >* instances = mSharedSource->mSharedInstances;
+		assert( instances && mSharedInstanceIndex < instances->size( ) && instances->at( mSharedInstanceIndex ) == this );
+
+		// Order of instances doesn't matter, so fill the gap with the last one
+		Component* last = instances->back( );
+		instances->at( mSharedInstanceIndex ) = last;
+		last->mSharedInstanceIndex = mSharedInstanceIndex;
+		instances->pop_back( );
+
+		mSharedSource = nullptr;
+	}
+	
+	//=========================================================================
+
+	void Component::ReleaseSharedData( bool detachInstances )
+	{
+		UnlinkSharedSource( );
+
+		if ( !mSharedInstances )
+		{
+			return;
+		}
+
+		if ( detachInstances )
+		{
+			// Each instance unlinks itself from the back of the list
+			while ( !mSharedInstances->empty( ) )
+			{
+				mSharedInstances->back( )->DetachSharedSource( );
+			}
+		}
+		else
+		{
+			for ( auto& c : *mSharedInstances )
+			{
+				c->mSharedSource = nullptr;
+			}
+		}
+
+		delete mSharedInstances;
+		mSharedInstances = nullptr;
+	}
+	
+	//=========================================================================
+
+	void Component::SetTickState( const ComponentTickState& state )
+	{
+		if ( mTickState != state )
+		{
+			mTickState = state;
+			RefreshTickEntry( );
+		}
+	}
+	
+	//=========================================================================
+
+	void Component::SetTickInterval( const u32& frames )
+	{
+		u32 interval = std::max< u32 >( frames, 1 );
+		if ( mTickInterval != interval )
+		{
+			mTickInterval = interval;
+			RefreshTickEntry( );
+		}
+	}
+	
+	//=========================================================================
+
 	void Component::PostConstruction( )
 	{ 
 		// Nothing by default...
@@ -91,20 +536,20 @@ namespace Enjon
 	{
 		if ( HasEntity( entityId ) )
 		{
-			auto cPtrList = &mComponentPtrs;
-			auto cMap = &mComponentMap;
+			u32 slot = mEntitySlots[ entityId ];
 
-			// Get component
-			auto compPtr = mComponentMap[entityId];
+			// Unlink slot from entity so it's no longer updated
+			mSlotEntities[ slot ] = INVALID_ENTITY_ID;
 
-			// Remove ptr from point list map
-			cPtrList->erase( std::remove( cPtrList->begin( ), cPtrList->end( ), compPtr ), cPtrList->end( ) );
+			// Finally remove from sparse set
+			mEntitySlots[ entityId ] = InvalidSlot;
+			mCount--;
 
-			// Finally remove from map
-			cMap->erase( entityId );
+			// Entry is skipped from now on and dropped at next compaction
+			UnlinkTickEntry( slot );
 
 			// Set component's base to nullptr
-			compPtr->mBase = nullptr;
+			mSlotComponents[ slot ]->mBase = nullptr;
 		}
 	} 
 	
@@ -117,28 +562,159 @@ namespace Enjon
 	
 	//=========================================================================
 
+	void ComponentArray::RefreshTickEntry( Component* component )
+	{
+		u32 slot = component->mStorageSlot;
+		assert( slot < mSlotComponents.size( ) && mSlotComponents[ slot ] == component );
+
+		UnlinkTickEntry( slot );
+		mPendingTickSlots.push_back( slot );
+	}
+	
+	//=========================================================================
+
+	void ComponentArray::UnlinkTickEntry( const u32& slot )
+	{
+		u32 list = mSlotTickLists[ slot ];
+		if ( list != InvalidSlot )
+		{
+			mTickLists[ list ].mComponents[ mSlotTickEntries[ slot ] ] = nullptr;
+			mSlotTickLists[ slot ] = InvalidSlot;
+			mDeadTickEntryCount++;
+		}
+	}
+	
+	//=========================================================================
+
+	void ComponentArray::AppendTickEntry( const u32& slot )
+	{
+		// Unlinked since it was queued, or already filed by an earlier entry in the queue
+		if ( mSlotEntities[ slot ] == INVALID_ENTITY_ID || mSlotTickLists[ slot ] != InvalidSlot )
+		{
+			return;
+		}
+
+		Component* c = mSlotComponents[ slot ];
+		Entity* ent = c->GetEntity( );
+		const World* world = ent ? ent->GetWorld( ) : nullptr;
+
+		// Entities outside of any world never update
+		if ( !world )
+		{
+			return;
+		}
+
+		auto list = std::find_if( mTickLists.begin( ), mTickLists.end( ), [ & ]( const ComponentTickList& l )
+		{
+			return l.mWorld == world && l.mTickState == c->mTickState && l.mTickInterval == c->mTickInterval;
+		} );
+
+		if ( list == mTickLists.end( ) )
+		{
+			ComponentTickList newList;
+			newList.mWorld = world;
+			newList.mTickState = c->mTickState;
+			newList.mTickInterval = c->mTickInterval;
+			mTickLists.push_back( newList );
+			list = mTickLists.end( ) - 1;
+		}
+
+		mSlotTickLists[ slot ] = ( u32 )( list - mTickLists.begin( ) );
+		mSlotTickEntries[ slot ] = ( u32 )list->mComponents.size( );
+		list->mComponents.push_back( c );
+		mTickEntryCount++;
+	}
+	
+	//=========================================================================
+
+	void ComponentArray::RebuildTickLists( )
+	{
+		for ( auto& list : mTickLists )
+		{
+			list.mComponents.clear( );
+		}
+
+		std::fill( mSlotTickLists.begin( ), mSlotTickLists.end( ), InvalidSlot );
+		mPendingTickSlots.clear( );
+		mTickEntryCount = 0;
+		mDeadTickEntryCount = 0;
+
+		// Walk slots in order so each list stays in storage order
+		for ( u32 slot = 0; slot < mSlotComponents.size( ); ++slot )
+		{
+			AppendTickEntry( slot );
+		}
+
+		// Drop lists left empty, which shifts the lists after them
+		mTickLists.erase( std::remove_if( mTickLists.begin( ), mTickLists.end( ), [ ]( const ComponentTickList& l )
+		{
+			return l.mComponents.empty( );
+		} ), mTickLists.end( ) );
+
+		for ( u32 l = 0; l < mTickLists.size( ); ++l )
+		{
+			for ( auto& c : mTickLists[ l ].mComponents )
+			{
+				mSlotTickLists[ c->mStorageSlot ] = l;
+			}
+		}
+	}
+	
+	//=========================================================================
+
+	void ComponentArray::UpdateTickLists( )
+	{
+		// Compacting refiles everything, including anything queued
+		if ( mDeadTickEntryCount && mDeadTickEntryCount * 100 >= mTickEntryCount * COMPONENT_TICK_LIST_COMPACT_PERCENT )
+		{
+			RebuildTickLists( );
+			return;
+		}
+
+		for ( auto& slot : mPendingTickSlots )
+		{
+			AppendTickEntry( slot );
+		}
+
+		mPendingTickSlots.clear( );
+	}
+	
+	//=========================================================================
+
 	void ComponentArray::Update( )
 	{
+		UpdateTickLists( );
+
 		// Get the application
 		const Application* app = Engine::GetInstance( )->GetApplication( );
+		bool running = app->GetApplicationState( ) == ApplicationState::Running;
  
-		// Update all components
-		for ( auto& c : mComponentPtrs )
+		for ( auto& list : mTickLists )
 		{
-			if ( c->GetTickState() == ComponentTickState::TickAlways || app->GetApplicationState( ) == ApplicationState::Running )
+			if ( !list.mWorld->ShouldUpdate( ) || ( list.mTickState == ComponentTickState::TickOnRunOnly && !running ) )
+			{
+				continue;
+			}
+
+			// Lists with an interval update every Nth component per frame, so each one updates once every N frames
+			u32 begin = mTickFrame % list.mTickInterval;
+			for ( u32 i = begin; i < list.mComponents.size( ); i += list.mTickInterval )
 			{
-				Entity* ent = c->GetEntity( );
-				if ( ent->GetWorld()->ShouldUpdate() && ent->GetState( ) == EntityState::ACTIVE )
+				// Skip entries of components removed since lists were compacted
+				Component* c = list.mComponents[ i ];
+				if ( !c )
+				{
+					continue;
+				}
+
+				if ( c->GetEntity( )->GetState( ) == EntityState::ACTIVE )
 				{
 					c->Update( ); 
 				}
 			}
-			// Otherwise kill loop and return ( Note: not cache friendly, but oh wells )
-			else
-			{
-				return;
-			}
 		} 
+
+		mTickFrame++;
 	}
 
 	//=========================================================================
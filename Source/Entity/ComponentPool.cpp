@@ -0,0 +1,114 @@
+// File: ComponentPool.cpp
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#include "Entity/ComponentPool.h"
+
+#include <assert.h>
+#include <algorithm>
+
+namespace Enjon
+{
+	//=========================================================================
+
+	ComponentPool::ComponentPool( const usize& stride, const u32& chunkCapacity )
+		: mStride( stride ), mChunkCapacity( chunkCapacity )
+	{
+		assert( mChunkCapacity > 0 );
+	}
+
+	//=========================================================================
+
+	ComponentPool::~ComponentPool( )
+	{
+		Shrink( );
+	}
+
+	//=========================================================================
+
+	u32 ComponentPool::Allocate( )
+	{
+		u32 slot = 0;
+
+		// Reuse previously freed slot if available
+		if ( !mFreeSlots.empty( ) )
+		{
+			slot = mFreeSlots.back( );
+			mFreeSlots.pop_back( );
+			mStats.mReusedAllocations++;
+		}
+		else
+		{
+			slot = mSlotCount++;
+
+			// Need a new chunk to hold this slot ( chunks are kept around after release )
+			if ( mStride && slot / mChunkCapacity >= mChunks.size( ) )
+			{
+				mChunks.push_back( new u8[ mStride * mChunkCapacity ] );
+				mStats.mChunkCount++;
+			}
+		}
+
+		mStats.mTotalAllocations++;
+		mStats.mLiveCount++;
+		mStats.mPeakLiveCount = std::max( mStats.mPeakLiveCount, mStats.mLiveCount );
+
+		return slot;
+	}
+
+	//=========================================================================
+
+	void ComponentPool::Free( const u32& slot )
+	{
+		assert( slot < mSlotCount );
+
+		mFreeSlots.push_back( slot );
+		mStats.mTotalFrees++;
+		mStats.mLiveCount--;
+	}
+
+	//=========================================================================
+
+	void ComponentPool::Reserve( const u32& count )
+	{
+		// Free slots are handed out first, only the remainder needs new slots
+		u32 reused = std::min( count, ( u32 )mFreeSlots.size( ) );
+		u32 required = mSlotCount + ( count - reused );
+
+		while ( mStride && mChunks.size( ) * mChunkCapacity < required )
+		{
+			mChunks.push_back( new u8[ mStride * mChunkCapacity ] );
+			mStats.mChunkCount++;
+		}
+	}
+
+	//=========================================================================
+
+	void ComponentPool::ReleaseAll( )
+	{
+		// No per slot bookkeeping necessary, just start handing out slots from the beginning again
+		mFreeSlots.clear( );
+		mSlotCount = 0;
+		mStats.mTotalFrees += mStats.mLiveCount;
+		mStats.mLiveCount = 0;
+		mStats.mBulkReleases++;
+	}
+
+	//=========================================================================
+
+	void ComponentPool::Shrink( )
+	{
+		for ( auto& c : mChunks )
+		{
+			delete[] c;
+			c = nullptr;
+		}
+
+		mChunks.clear( );
+		mFreeSlots.clear( );
+		mSlotCount = 0;
+		mStats.mLiveCount = 0;
+		mStats.mChunkCount = 0;
+	}
+
+	//=========================================================================
+}
@@ -0,0 +1,221 @@
+// File: ComponentScheduler.cpp
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#include "Entity/ComponentScheduler.h"
+#include "Entity/Component.h"
+#include "System/JobSystem.h"
+#include "Base/Object.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace Enjon
+{
+	//=========================================================================
+
+	INTERNAL bool ContainsType( const Vector< u32 >& list, const u32& type )
+	{
+		return std::find( list.begin( ), list.end( ), type ) != list.end( );
+	}
+
+	//=========================================================================
+
+	INTERNAL bool IntersectsTypes( const Vector< u32 >& a, const Vector< u32 >& b )
+	{
+		for ( auto& t : a )
+		{
+			if ( ContainsType( b, t ) )
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	//=========================================================================
+
+	INTERNAL void ResolveClassList( const Vector< String >& names, Vector< const MetaClass* >* out )
+	{
+		for ( auto& n : names )
+		{
+			const MetaClass* cls = Object::GetClass( n );
+			if ( cls )
+			{
+				out->push_back( cls );
+			}
+		}
+	}
+
+	//=========================================================================
+
+	void ComponentScheduler::RegisterAccess( const MetaClass* cls )
+	{
+		const MetaClassComponent* cc = static_cast< const MetaClassComponent* >( cls );
+		if ( !cc || !cc->HasDeclaredAccess( ) )
+		{
+			return;
+		}
+
+		Vector< const MetaClass* > reads, writes;
+		ResolveClassList( cc->GetReadComponentList( ), &reads );
+		ResolveClassList( cc->GetWriteComponentList( ), &writes );
+
+		SetAccess( cls, reads, writes );
+	}
+
+	//=========================================================================
+
+	void ComponentScheduler::SetAccess( const MetaClass* cls, const Vector< const MetaClass* >& reads, const Vector< const MetaClass* >& writes )
+	{
+		ComponentAccess access;
+		access.mDeclared = true;
+
+		// Updating a component array always writes into its own components
+		access.mWrites.push_back( cls->GetTypeId( ) );
+
+		for ( auto& r : reads )
+		{
+			if ( r && !ContainsType( access.mReads, r->GetTypeId( ) ) )
+			{
+				access.mReads.push_back( r->GetTypeId( ) );
+			}
+		}
+
+		for ( auto& w : writes )
+		{
+			if ( w && !ContainsType( access.mWrites, w->GetTypeId( ) ) )
+			{
+				access.mWrites.push_back( w->GetTypeId( ) );
+			}
+		}
+
+		mAccess[ cls->GetTypeId( ) ] = access;
+	}
+
+	//=========================================================================
+
+	void ComponentScheduler::RemoveAccess( const MetaClass* cls )
+	{
+		mAccess.erase( cls->GetTypeId( ) );
+	}
+
+	//=========================================================================
+
+	const ComponentAccess* ComponentScheduler::GetAccess( const u32& type ) const
+	{
+		auto query = mAccess.find( type );
+		if ( query != mAccess.end( ) && query->second.mDeclared )
+		{
+			return &query->second;
+		}
+
+		return nullptr;
+	}
+
+	//=========================================================================
+
+	bool ComponentScheduler::Conflicts( const u32& a, const u32& b ) const
+	{
+		const ComponentAccess* accessA = GetAccess( a );
+		const ComponentAccess* accessB = GetAccess( b );
+
+		// Undeclared access is exclusive
+		if ( !accessA || !accessB )
+		{
+			return true;
+		}
+
+		return ( IntersectsTypes( accessA->mWrites, accessB->mWrites ) ||
+				 IntersectsTypes( accessA->mWrites, accessB->mReads ) ||
+				 IntersectsTypes( accessB->mWrites, accessA->mReads ) );
+	}
+
+	//=========================================================================
+
+	void ComponentScheduler::Run( const Vector< u32 >& types, const Vector< ComponentWrapperBase* >& arrays, JobSystem* jobSystem )
+	{
+		using Clock = std::chrono::high_resolution_clock;
+
+		mWaves.clear( );
+		mTrace.clear( );
+
+		// Only schedule arrays that actually have work
+		Vector< u32 > active;
+		for ( auto& t : types )
+		{
+			if ( t < arrays.size( ) && arrays[ t ] && !arrays[ t ]->IsEmpty( ) )
+			{
+				active.push_back( t );
+			}
+		}
+
+		// Each type runs one wave after the latest wave of any earlier type it conflicts with
+		Vector< u32 > waveIndices( active.size( ), 0 );
+		for ( u32 j = 0; j < active.size( ); ++j )
+		{
+			for ( u32 i = 0; i < j; ++i )
+			{
+				if ( Conflicts( active[ i ], active[ j ] ) )
+				{
+					waveIndices[ j ] = std::max( waveIndices[ j ], waveIndices[ i ] + 1 );
+				}
+			}
+
+			if ( waveIndices[ j ] >= mWaves.size( ) )
+			{
+				mWaves.resize( waveIndices[ j ] + 1 );
+			}
+
+			mWaves[ waveIndices[ j ] ].push_back( active[ j ] );
+		}
+
+		// Each update writes only its own trace entry, so no synchronization is needed
+		mTrace.resize( active.size( ) );
+
+		Clock::time_point frameStart = Clock::now( );
+		u32 traceIndex = 0;
+
+		for ( u32 w = 0; w < mWaves.size( ); ++w )
+		{
+			Vector< Job > jobs;
+			jobs.reserve( mWaves[ w ].size( ) );
+
+			for ( auto& t : mWaves[ w ] )
+			{
+				ComponentUpdateTrace* trace = &mTrace[ traceIndex++ ];
+				ComponentWrapperBase* base = arrays[ t ];
+
+				jobs.push_back( [ trace, base, t, w, frameStart ]( )
+				{
+					Clock::time_point start = Clock::now( );
+
+					base->Update( );
+
+					Clock::time_point end = Clock::now( );
+
+					trace->mComponentType = t;
+					trace->mWave = w;
+					trace->mThreadIndex = JobSystem::GetCurrentThreadIndex( );
+					trace->mStartMS = std::chrono::duration< f32, std::milli >( start - frameStart ).count( );
+					trace->mDurationMS = std::chrono::duration< f32, std::milli >( end - start ).count( );
+				} );
+			}
+
+			// Barrier between waves
+			if ( jobSystem && mParallelEnabled )
+			{
+				jobSystem->RunAndWait( jobs );
+			}
+			else
+			{
+				for ( auto& j : jobs )
+				{
+					j( );
+				}
+			}
+		}
+	}
+
+	//=========================================================================
+}
@@ -332,6 +332,14 @@ namespace Enjon
 
 	//======================================================================== 
 
+	Result RigidBodyComponent::CopyData( const Object* source )
+	{
+		// Copy mBody
+		return ObjectArchiver::Copy( &source->Cast< RigidBodyComponent >( )->mBody, &mBody );
+	}
+
+	//======================================================================== 
+
 	Result RigidBodyComponent::DeserializeLateInit( )
 	{
 		// Reinitialize rigidbody
@@ -12,9 +12,14 @@ namespace Enjon
 
 	void SkeletalAnimationComponent::UpdateAndCalculateTransforms( )
 	{
-		// Get skeletal mesh component and renderable from entity
-		SkeletalMeshComponent* smc = mEntity->GetComponent< SkeletalMeshComponent >( );
+		// Get skeletal mesh component from entity and calculate
+		UpdateAndCalculateTransforms( mEntity->GetComponent< SkeletalMeshComponent >( ) );
+	}
+
+	//==================================================================================
 
+	void SkeletalAnimationComponent::UpdateAndCalculateTransforms( SkeletalMeshComponent* smc )
+	{
 		// If not valid, return ( NOTE(): this branching check will eventually go away with Require tags )
 		if ( !smc )
 		{
@@ -24,14 +29,15 @@ namespace Enjon
 		// Grab renderable from skeletal mesh component
 		SkeletalMeshRenderable* renderable = &smc->mRenderable; 
 		AssetHandle< Skeleton > skeleton = renderable->GetSkeleton( );
+		AssetHandle< SkeletalAnimation > animation = ReadShared( &SkeletalAnimationComponent::mAnimation );
 
-		if ( !skeleton || !mAnimation )
+		if ( !skeleton || !animation )
 		{
 			return;
 		}
 
 		// Make sure that skeletons line up between renderable and animation
-		if ( skeleton.Get( ) != mAnimation.Get( )->mSkeleton.Get() )
+		if ( skeleton.Get( ) != animation.Get( )->mSkeleton.Get() )
 		{
 			return;
 		}
@@ -52,18 +58,20 @@ namespace Enjon
 			mats.resize( skeleton.Get( )->GetNumberOfJoints( ) );
 		} 
 		
-		// Calculate matrix transforms for skeletal mesh
-		skeleton.Get( )->CalculateTransform( rootID, Mat4x4::Identity( ), mats, mAnimation.Get(), mCurrentAnimationTime ); 
+		// Sample and convert all joints in bulk, then calculate matrix transforms for skeletal mesh
+		skeleton.Get( )->CalculateJointMatrices( animation.Get( ), mCurrentAnimationTime, mJointTransforms, mJointMatrices );
+		skeleton.Get( )->CalculateTransform( rootID, Mat4x4::Identity( ), mats, &mJointMatrices ); 
 
 		// Increment current animation time ( this is hacked to just use a single animation for now... )
-		mCurrentAnimationTime = std::fmod( mCurrentAnimationTime + Engine::GetInstance( )->GetWorldTime( ).GetDeltaTime( ) * mAnimationSpeed, mAnimation->GetDuration( ) );
+		f32 speed = ReadShared( &SkeletalAnimationComponent::mAnimationSpeed );
+		mCurrentAnimationTime = std::fmod( mCurrentAnimationTime + Engine::GetInstance( )->GetWorldTime( ).GetDeltaTime( ) * speed, animation->GetDuration( ) );
 	} 
 
 	//================================================================================== 
 
 	void SkeletalAnimationComponent::SetAnimation( const AssetHandle< SkeletalAnimation >& animation )
 	{
-		mAnimation = animation;
+		WriteShared( &SkeletalAnimationComponent::mAnimation ) = animation;
 	}
 
 	//================================================================================== 
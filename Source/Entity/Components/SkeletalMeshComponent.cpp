@@ -221,6 +221,24 @@ namespace Enjon
 		return Result::SUCCESS;
 	}
 
+	//====================================================================
+
+	Result SkeletalMeshComponent::CopyData( const Object* source )
+	{
+		const SkeletalMeshComponent* other = source->Cast< SkeletalMeshComponent >( );
+
+		// Share mesh and materials with source renderable
+		mRenderable.SetMesh( other->mRenderable.GetMesh( ) );
+
+		u32 matIndex = 0;
+		for ( auto& mat : other->mRenderable.GetMaterials( ) )
+		{
+			mRenderable.SetMaterial( mat, matIndex++ );
+		}
+
+		return Result::SUCCESS;
+	}
+
 	//==================================================================== 
 
 	Result SkeletalMeshComponent::OnEditorUI( )
@@ -84,7 +84,14 @@ namespace Enjon
 
 	void StaticMeshComponent::Update( )
 	{
-		mRenderable.SetTransform(mEntity->GetWorldTransform());
+		// Static props never change transform, so only push it into the renderable when the entity's has changed
+		u32 version = mEntity->GetTransformVersion( );
+		if ( version != mTransformVersion )
+		{
+			mRenderable.SetTransform(mEntity->GetWorldTransform());
+			mTransformVersion = version;
+			MarkChanged( );
+		}
 	}
 	
 	//====================================================================
@@ -147,6 +154,7 @@ namespace Enjon
 	void StaticMeshComponent::SetTransform( const Transform& transform )
 	{
 		mRenderable.SetTransform( transform );
+		MarkChanged( );
 	}
 
 	//====================================================================
@@ -243,6 +251,24 @@ namespace Enjon
 		return Result::SUCCESS;
 	}
 
+	//====================================================================
+
+	Result StaticMeshComponent::CopyData( const Object* source )
+	{
+		const StaticMeshComponent* other = source->Cast< StaticMeshComponent >( );
+
+		// Share mesh and materials with source renderable
+		mRenderable.SetMesh( other->mRenderable.GetMesh( ) );
+
+		u32 matIndex = 0;
+		for ( auto& mat : other->mRenderable.GetMaterials( ) )
+		{
+			mRenderable.SetMaterial( mat, matIndex++ );
+		}
+
+		return Result::SUCCESS;
+	}
+
 	//==================================================================== 
 
 	Result StaticMeshComponent::OnEditorUI( )
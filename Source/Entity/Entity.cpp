@@ -9,6 +9,7 @@
 #include "Base/World.h"
 
 #include <fmt/format.h>
+#include <cstring>
 
 namespace Enjon 
 {
@@ -28,7 +29,13 @@ namespace Enjon
 			if ( ImGui::CollapsingHeader( "Label" ) )
 			{
 				ImGui::PushFont( igm->GetFont( "WeblySleek_14" ) );
-				igm->DebugDumpProperty( this, Class( )->GetPropertyByName( ENJON_TO_STRING( mName ) ) ); 
+				char buffer[ 256 ];
+				std::strncpy( buffer, GetName( ).c_str( ), 256 );
+				buffer[ 255 ] = '\0';
+				if ( ImGui::InputText( "Name", buffer, 256 ) )
+				{
+					SetName( String( buffer ) );
+				}
 				ImGui::PopFont( ); 
 			}
 
@@ -39,6 +46,14 @@ namespace Enjon
 				ImGui::PushFont( igm->GetFont( "WeblySleek_14" ) );
 				igm->DebugDumpProperty( this, Class( )->GetPropertyByName( ENJON_TO_STRING( mLocalTransform ) ) ); 
 				ImGui::PopFont( );
+
+				// Edited directly through reflection, so cached world transforms need to be flagged
+				if ( current.GetPosition( ) != mLocalTransform.GetPosition( ) || 
+					 current.GetRotation( ) != mLocalTransform.GetRotation( ) || 
+					 current.GetScale( ) != mLocalTransform.GetScale( ) )
+				{
+					SetWorldTransformDirty( );
+				}
 			} 
 
 			for ( auto& c : GetComponents( ) )
@@ -108,16 +123,27 @@ namespace Enjon
 
 	//===================================================================== 
 
+	u32 Entity::GetGeneration( ) const
+	{
+		return mHot->mGeneration;
+	}
+
+	//===================================================================== 
+
 	String Entity::GetName( ) const
 	{
-		return mName;
+		return mColdData ? mColdData->mName : "Entity";
 	}
 
 	//===================================================================== 
 
 	void Entity::SetName( const String& name )
 	{
-		mName = name;
+		// Entities keeping the default label don't need cold data
+		if ( mColdData || name.compare( "Entity" ) != 0 )
+		{
+			GetColdData( )->mName = name;
+		}
 	}
 
 	//===================================================================== 
@@ -163,6 +189,8 @@ namespace Enjon
 			{
 				ObjectArchiver::MergeProperty( &source->mLocalTransform, &mLocalTransform, rotationProp, mergeType );
 			}
+
+			SetWorldTransformDirty( );
 		} 
 
 		bool componentPropChangeExists = false;
@@ -260,7 +288,7 @@ namespace Enjon
 				ObjectArchiver::MergeObjects( sourceEnt, instanced.Get( ), mergeType );
 
 				// Set archetype of instanced entity to this archetype
-				instanced.Get( )->SetArchetype( mArchetype );
+				instanced.Get( )->SetArchetype( GetArchetype( ) );
 
 				// Set local transform 
 				instanced.Get( )->SetLocalTransform( localTransform );
@@ -334,7 +362,7 @@ namespace Enjon
 		for ( auto& c : GetComponents() )
 		{
 			// Only record overrides if proto entity has component as well
-			Component* sourceComponent = mPrototypeEntity.Get( )->GetComponent( c->Class( ) );
+			Component* sourceComponent = GetPrototypeEntity( ).Get( )->GetComponent( c->Class( ) );
 			if ( sourceComponent )
 			{
 				ObjectArchiver::RecordAllPropertyOverrides( sourceComponent, c ); 
@@ -0,0 +1,80 @@
+// File: EntityCommandBuffer.cpp
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#include "Entity/EntityCommandBuffer.h"
+#include "Entity/EntityManager.h"
+
+namespace Enjon
+{
+	//=========================================================================
+
+	EntityCommandTarget::EntityCommandTarget( const EntityHandle& handle )
+		: mID( handle.GetID( ) ), mGeneration( handle.GetGeneration( ) )
+	{
+	}
+
+	//=========================================================================
+
+	EntityCommandTarget::EntityCommandTarget( const DeferredEntity& entity )
+		: mDeferredIndex( entity.mIndex )
+	{
+	}
+
+	//=========================================================================
+
+	DeferredEntity EntityCommandBuffer::CreateEntity( World* world )
+	{
+		DeferredEntity entity;
+		entity.mIndex = ( u32 )mDeferredWorlds.size( );
+		mDeferredWorlds.push_back( world );
+
+		Record( EntityCommandType::CreateEntity, entity, nullptr, nullptr );
+
+		return entity;
+	}
+
+	//=========================================================================
+
+	void EntityCommandBuffer::DestroyEntity( const EntityCommandTarget& target )
+	{
+		Record( EntityCommandType::DestroyEntity, target, nullptr, nullptr );
+	}
+
+	//=========================================================================
+
+	void EntityCommandBuffer::AddComponent( const EntityCommandTarget& target, const MetaClass* compCls, const ComponentCommandFunction& func )
+	{
+		assert( compCls != nullptr );
+		Record( EntityCommandType::AddComponent, target, compCls, func );
+	}
+
+	//=========================================================================
+
+	void EntityCommandBuffer::RemoveComponent( const EntityCommandTarget& target, const MetaClass* compCls )
+	{
+		assert( compCls != nullptr );
+		Record( EntityCommandType::RemoveComponent, target, compCls, nullptr );
+	}
+
+	//=========================================================================
+
+	void EntityCommandBuffer::Record( const EntityCommandType& type, const EntityCommandTarget& target, const MetaClass* compCls, const ComponentCommandFunction& func )
+	{
+		// Deferred entities only resolve within the buffer that created them
+		assert( target.mDeferredIndex == INVALID_ENTITY_ID || target.mDeferredIndex < mDeferredWorlds.size( ) );
+
+		EntityCommand command = { type, target, mSortKey, compCls, func };
+		mCommands.push_back( command );
+	}
+
+	//=========================================================================
+
+	void EntityCommandBuffer::Clear( )
+	{
+		mCommands.clear( );
+		mDeferredWorlds.clear( );
+		mSortKey = 0;
+	}
+
+	//=========================================================================
+}
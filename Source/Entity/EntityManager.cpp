@@ -8,6 +8,9 @@
 #include "Entity/Components/SkeletalMeshComponent.h"
 #include "Entity/Components/SkeletalAnimationComponent.h"
 #include "Graphics/GraphicsSubsystem.h"
+#include "Graphics/GraphicsScene.h"
+#include "Physics/PhysicsSubsystem.h"
+#include "System/JobSystem.h"
 #include "SubsystemCatalog.h"
 #include "Serialize/EntityArchiver.h"
 #include "Base/World.h"
@@ -18,6 +21,7 @@
 #include <vector>
 #include <assert.h>
 #include <algorithm> 
+#include <atomic>
 
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
@@ -29,8 +33,18 @@ namespace Enjon
 {
 	//================================================================================================
 
+	// Source of entity transform versions, unique per stamp so readers can compare versions for equality
+	INTERNAL std::atomic< u32 > gTransformVersion( 0 );
+
+	INTERNAL u32 NextTransformVersion( )
+	{
+		return gTransformVersion.fetch_add( 1, std::memory_order_relaxed ) + 1;
+	}
+
+	//================================================================================================
+
 	EntityHandle::EntityHandle( )
-		: mID( MAX_ENTITIES )
+		: mID( INVALID_ENTITY_ID )
 	{
 	}
 
@@ -41,6 +55,7 @@ namespace Enjon
 		if ( entity )
 		{
 			mID = entity->mID;
+			mGeneration = entity->mHot->mGeneration;
 		}
 	}
 
@@ -80,10 +95,17 @@ namespace Enjon
 
 	//================================================================================================
 
+	u32 EntityHandle::GetGeneration( ) const
+	{
+		return mGeneration;
+	}
+
+	//================================================================================================
+
 	Enjon::Entity* EntityHandle::Get( ) const
 	{
 		EntityManager* manager = EngineSubsystem( EntityManager );
-		return manager->GetRawEntity( mID );
+		return manager->GetRawEntity( mID, mGeneration );
 	}
 
 	//================================================================================================
@@ -91,16 +113,15 @@ namespace Enjon
 	bool operator==( EntityHandle left, const EntityHandle& other )
 	{
 		// Compare raw entity pointers and ids for match
-		return ( left.Get( ) == other.Get( ) ) && ( left.mID == other.mID );
+		return ( left.Get( ) == other.Get( ) ) && ( left.mID == other.mID ) && ( left.mGeneration == other.mGeneration );
 	}
 
 	//================================================================================================
 
 	void Entity::ExplicitConstructor( )
 	{
-		mID = MAX_ENTITIES;
-		mState = EntityState::INVALID;
-		mWorldTransformDirty = true;
+		// State, generation and dirty flag start out on their defaults in the slot's hot data
+		mID = INVALID_ENTITY_ID;
 		mIsArchetypeRoot = false;
 	}
 
@@ -109,6 +130,7 @@ namespace Enjon
 	void Entity::ExplicitDestructor( )
 	{
 		this->Destroy( );
+		ReleaseColdData( );
 	}
 
 	//=================================================================
@@ -122,21 +144,41 @@ namespace Enjon
 
 	bool Entity::HasPrototypeEntity( ) const
 	{
-		return ( mPrototypeEntity.IsValid( ) );
+		return ( mColdData && mColdData->mPrototypeEntity.IsValid( ) );
 	}
 
 	//=================================================================
 
 	EntityHandle Entity::GetPrototypeEntity( ) const
 	{
-		return mPrototypeEntity;
+		return mColdData ? mColdData->mPrototypeEntity : EntityHandle::Invalid( );
+	}
+
+	//=================================================================
+
+	EntityColdData* Entity::GetColdData( )
+	{
+		if ( !mColdData )
+		{
+			mColdData = new EntityColdData( );
+		}
+
+		return mColdData;
+	}
+
+	//=================================================================
+
+	void Entity::ReleaseColdData( )
+	{
+		delete mColdData;
+		mColdData = nullptr;
 	}
 
 	//=================================================================
 
 	const EntityState& Entity::GetState( ) const
 	{
-		return mState;
+		return mHot->mState;
 	}
 
 	//=================================================================
@@ -165,7 +207,11 @@ namespace Enjon
 
 	void Entity::SetArchetype( const AssetHandle< Archetype >& archType )
 	{
-		mArchetype = archType;
+		// Don't allocate cold data just to store a null archetype
+		if ( archType.IsValid( ) || mColdData )
+		{
+			GetColdData( )->mArchetype = archType;
+		}
 	}
 
 	//=================================================================
@@ -180,8 +226,8 @@ namespace Enjon
 		// Set handle and add instance
 		if ( handle.Get( ) )
 		{ 
-			mPrototypeEntity = handle; 
-			mPrototypeEntity.Get( )->AddInstance( this );
+			GetColdData( )->mPrototypeEntity = handle; 
+			handle.Get( )->AddInstance( this );
 		}
 	}
 
@@ -189,10 +235,10 @@ namespace Enjon
 
 	void Entity::RemovePrototypeEntity( )
 	{
-		if ( mPrototypeEntity )
+		if ( mColdData && mColdData->mPrototypeEntity )
 		{
-			mPrototypeEntity.Get( )->RemoveInstance( this );
-			mPrototypeEntity = EntityHandle::Invalid( );
+			mColdData->mPrototypeEntity.Get( )->RemoveInstance( this );
+			mColdData->mPrototypeEntity = EntityHandle::Invalid( );
 		}
 	}
 
@@ -202,7 +248,7 @@ namespace Enjon
 	{
 		if ( handle.Get( ) )
 		{
-			mInstancedEntities.insert( handle.GetID( ) );
+			GetColdData( )->mInstancedEntities.insert( handle.GetID( ) );
 		}
 	}
 
@@ -210,9 +256,9 @@ namespace Enjon
 
 	void Entity::RemoveInstance( const EntityHandle& handle ) 
 	{
-		if ( handle.Get( ) )
+		if ( handle.Get( ) && mColdData )
 		{
-			mInstancedEntities.erase( handle.GetID( ) );
+			mColdData->mInstancedEntities.erase( handle.GetID( ) );
 		}
 	}
 
@@ -260,7 +306,7 @@ namespace Enjon
 		}
 
 		// Remove from prototype's instances
-		if ( mPrototypeEntity )
+		if ( HasPrototypeEntity( ) )
 		{
 			RemovePrototypeEntity( );
 		}
@@ -277,17 +323,25 @@ namespace Enjon
 		} 
 
 		// Reset all fields
+		ResetData( );
+
+		// Remove from world
+		RemoveFromWorld( );
+	}
+
+	//====================================================================================================
+
+	void Entity::ResetData( )
+	{
 		mLocalTransform = Enjon::Transform( );
 		mWorldTransform = Enjon::Transform( );
-		mInstancedEntities.clear( );
-		mID = MAX_ENTITIES;
-		mState = EntityState::INVALID;
-		mWorldTransformDirty = true;
+		ReleaseColdData( );
+		mID = INVALID_ENTITY_ID;
+		mHot->mState = EntityState::INVALID;
+		mHot->mWorldTransformDirty = true;
+		mHot->mComponentMask = 0;
 		mComponents.clear( );
 		mChildren.clear( );
-
-		// Remove from world
-		RemoveFromWorld( );
 	}
 
 	//====================================================================================================
@@ -337,6 +391,12 @@ namespace Enjon
 
 	bool Entity::HasComponent( const MetaClass* compCls )
 	{
+		u64 mask = EngineSubsystem( EntityManager )->GetComponentMask( compCls->GetTypeId( ) );
+		if ( mask )
+		{
+			return ( mHot->mComponentMask & mask ) != 0;
+		}
+
 		return ( std::find( mComponents.begin( ), mComponents.end( ), compCls->GetTypeId( ) ) != mComponents.end( ) );
 	}
 
@@ -359,9 +419,12 @@ namespace Enjon
 	{
 		EntityManager* em = EngineSubsystem( EntityManager );
 		Vector< EntityHandle > handles;
-		for ( auto& id : mInstancedEntities )
+		if ( mColdData )
 		{
-			handles.push_back( em->GetRawEntity( id ) );
+			for ( auto& id : mColdData->mInstancedEntities )
+			{
+				handles.push_back( em->GetRawEntity( id ) );
+			}
 		}
 		return handles;
 	}
@@ -389,14 +452,13 @@ namespace Enjon
 	void Entity::SetLocalTransform( const Transform& transform, bool propagateToComponents )
 	{
 		mLocalTransform = transform;
+		SetWorldTransformDirty( );
 
 		if ( propagateToComponents )
 		{
 			CalculateWorldTransform( );
 			UpdateComponentTransforms( );
 		}
-
-		mWorldTransformDirty = true;
 	}
 
 	//==========================================================================================
@@ -404,19 +466,21 @@ namespace Enjon
 	void Entity::SetWorldTransform( const Transform& transform, bool propagateToComponents )
 	{
 		mWorldTransform = transform; 
+		mTransformVersion = NextTransformVersion( );
 		CalculateLocalTransform( );
+		SetAllChildWorldTransformsDirty( );
 		if ( propagateToComponents )
 		{
 			UpdateComponentTransforms( );
 		} 
-		mWorldTransformDirty = false;
+		mHot->mWorldTransformDirty = false;
 	}
 
 	//==========================================================================================
 
 	AssetHandle< Archetype > Entity::GetArchetype( ) const
 	{
-		return mArchetype;
+		return mColdData ? mColdData->mArchetype : AssetHandle< Archetype >( );
 	}
 
 	//==========================================================================================
@@ -429,11 +493,19 @@ namespace Enjon
 	//---------------------------------------------------------------
 	Transform Entity::GetWorldTransform( )
 	{
-		// Calculate world transform
-		CalculateWorldTransform( );
+		// Cached world transform is valid until local transform of this entity or any ancestor changes
+		if ( !mHot->mWorldTransformDirty )
+		{
+			return mWorldTransform;
+		}
 
-		// Return world transform
-		return mWorldTransform;
+		// Calculate without caching so concurrent readers never write to the entity
+		if ( !HasParent( ) )
+		{
+			return mLocalTransform;
+		}
+
+		return mLocalTransform * mHot->mParent.Get( )->GetWorldTransform( );
 	}
 
 	//===========================================================================
@@ -447,7 +519,7 @@ namespace Enjon
 		if ( HasParent( ) )
 		{
 			// Grab parent entity
-			Enjon::Entity* parent = mParent.Get( );
+			Enjon::Entity* parent = mHot->mParent.Get( );
 
 			// Set local transform relative to parent transform
 			mLocalTransform = mWorldTransform / parent->GetWorldTransform( );
@@ -466,20 +538,31 @@ namespace Enjon
 		// WorldRot = LocalRot * ParentRot
 		// WorldPos = ParentPos + [ ParentRot * ( ParentScale * LocalPos ) ]
 
+		mTransformVersion = NextTransformVersion( );
+
 		if ( !HasParent( ) )
 		{
 			mWorldTransform = mLocalTransform;
+			mHot->mWorldTransformDirty = false;
 			return;
 		}
 
 		// Get parent transform recursively
-		Enjon::Entity* p = mParent.Get( );
+		Enjon::Entity* p = mHot->mParent.Get( );
 
 		// Set world transform
 		mWorldTransform = mLocalTransform * p->GetWorldTransform( );
 
 		// Set world transform flag to being clean
-		mWorldTransformDirty = false;
+		mHot->mWorldTransformDirty = false;
+	}
+
+	//===========================================================================
+
+	void Entity::SetWorldTransformDirty( )
+	{
+		mHot->mWorldTransformDirty = true;
+		SetAllChildWorldTransformsDirty( );
 	}
 
 	//===========================================================================
@@ -497,14 +580,13 @@ namespace Enjon
 	void Entity::SetLocalPosition( Vec3& position, bool propagateToComponents )
 	{
 		mLocalTransform.SetPosition( position );
+		SetWorldTransformDirty( );
 
 		if ( propagateToComponents )
 		{
 			CalculateWorldTransform( );
 			UpdateComponentTransforms( );
 		}
-
-		mWorldTransformDirty = true;
 	}
 
 	//===========================================================================
@@ -519,14 +601,13 @@ namespace Enjon
 	void Entity::SetLocalScale( Vec3& scale, bool propagateToComponents )
 	{
 		mLocalTransform.SetScale( scale );
+		SetWorldTransformDirty( );
 
 		if ( propagateToComponents )
 		{
 			CalculateWorldTransform( );
 			UpdateComponentTransforms( );
 		} 
-
-		mWorldTransformDirty = true;
 	}
 
 	//==============================================================================
@@ -534,14 +615,13 @@ namespace Enjon
 	void Entity::SetLocalRotation( Quaternion& rotation, bool propagateToComponents )
 	{
 		mLocalTransform.SetRotation( rotation );
+		SetWorldTransformDirty( );
 
 		if ( propagateToComponents )
 		{
 			CalculateWorldTransform( );
 			UpdateComponentTransforms( );
 		} 
-
-		mWorldTransformDirty = true;
 	}
 
 	//==============================================================================
@@ -549,14 +629,13 @@ namespace Enjon
 	void Entity::SetLocalRotation( Vec3& eulerAngles, bool propagateToComponents )
 	{
 		mLocalTransform.SetEulerRotation( eulerAngles );
+		SetWorldTransformDirty( );
 
 		if ( propagateToComponents )
 		{
 			CalculateWorldTransform( );
 			UpdateComponentTransforms( );
 		}
-
-		mWorldTransformDirty = true;
 	}
 
 	//==============================================================================
@@ -584,87 +663,94 @@ namespace Enjon
 
 	void Entity::SetWorldPosition( Vec3& position, bool propagateToComponents )
 	{ 
+		if ( mHot->mWorldTransformDirty ) CalculateWorldTransform( );
 		mWorldTransform.SetPosition( position );
 		CalculateLocalTransform( ); 
+		SetAllChildWorldTransformsDirty( );
 		if ( propagateToComponents )
 		{
 			UpdateComponentTransforms( );
 		} 
-		mWorldTransformDirty = false;
+		mHot->mWorldTransformDirty = false;
 	}
 
 	//==============================================================================
 
 	void Entity::SetWorldScale( Vec3& scale, bool propagateToComponents )
 	{
+		if ( mHot->mWorldTransformDirty ) CalculateWorldTransform( );
 		mWorldTransform.SetScale( scale );
 		CalculateLocalTransform( ); 
+		SetAllChildWorldTransformsDirty( );
 		if ( propagateToComponents )
 		{
 			UpdateComponentTransforms( );
 		} 
-		mWorldTransformDirty = false; 
+		mHot->mWorldTransformDirty = false; 
 	}
 
 	//==============================================================================
 
 	void Entity::SetWorldScale( f32 scale, bool propagateToComponents )
 	{
+		if ( mHot->mWorldTransformDirty ) CalculateWorldTransform( );
 		mWorldTransform.SetScale( scale );
 		CalculateLocalTransform( ); 
+		SetAllChildWorldTransformsDirty( );
 		if ( propagateToComponents )
 		{
 			UpdateComponentTransforms( );
 		} 
-		mWorldTransformDirty = false; 
+		mHot->mWorldTransformDirty = false; 
 	}
 
 	//==============================================================================
 
 	void Entity::SetWorldRotation( Quaternion& rotation, bool propagateToComponents )
 	{
+		if ( mHot->mWorldTransformDirty ) CalculateWorldTransform( );
 		mWorldTransform.SetRotation( rotation );
 		CalculateLocalTransform( ); 
+		SetAllChildWorldTransformsDirty( );
 		if ( propagateToComponents )
 		{
 			UpdateComponentTransforms( );
 		} 
-		mWorldTransformDirty = false; 
+		mHot->mWorldTransformDirty = false; 
 	}
 
 	//==============================================================================
 	
 	void Entity::SetWorldRotation( Vec3& eulerAngles, bool propagateToComponents )
 	{
+		if ( mHot->mWorldTransformDirty ) CalculateWorldTransform( );
 		mWorldTransform.SetEulerRotation( eulerAngles );
 		CalculateLocalTransform( ); 
+		SetAllChildWorldTransformsDirty( );
 		if ( propagateToComponents )
 		{
 			UpdateComponentTransforms( );
 		} 
-		mWorldTransformDirty = false; 
+		mHot->mWorldTransformDirty = false; 
 	}
 
 	//==============================================================================
 
 	Vec3 Entity::GetWorldPosition( )
 	{
-		if ( mWorldTransformDirty ) CalculateWorldTransform( );
-		return mWorldTransform.GetPosition( );
+		return GetWorldTransform( ).GetPosition( );
 	}
 
 	//---------------------------------------------------------------
 	Vec3 Entity::GetWorldScale( )
 	{
-		if ( mWorldTransformDirty ) CalculateWorldTransform( );
-		return mWorldTransform.GetScale( );
+		return GetWorldTransform( ).GetScale( );
 	}
 
 	//---------------------------------------------------------------
 	Quaternion Entity::GetWorldRotation( )
 	{
-		if ( mWorldTransformDirty ) CalculateWorldTransform( );
-		return mWorldTransform.GetRotation( );
+		return GetWorldTransform( ).GetRotation( );
 	}
 
 	//-----------------------------------------
@@ -747,7 +833,12 @@ namespace Enjon
 		child.Get( )->mLocalTransform = child.Get( )->mWorldTransform;
 
 		// Set parent to invalid entity handle
-		child.Get( )->mParent = EntityHandle( );
+		child.Get( )->mHot->mParent = EntityHandle( );
+
+		// Child is now a root
+		EntityManager* em = EngineSubsystem( EntityManager );
+		em->SetTransformHierarchyDirty( );
+		em->UpdateWorldRootEntry( child.Get( ) );
 	}
 
 	//-----------------------------------------
@@ -757,23 +848,28 @@ namespace Enjon
 		CalculateWorldTransform( );
 
 		// Set parent to this
-		mParent = parent.Get( );
+		mHot->mParent = parent.Get( );
 
 		// Calculate local transform relative to parent
 		CalculateLocalTransform( );
+
+		// Parent must now be propagated before this entity
+		EntityManager* em = EngineSubsystem( EntityManager );
+		em->SetTransformHierarchyDirty( );
+		em->UpdateWorldRootEntry( this );
 	}
 
 	//-----------------------------------------
 	void Entity::RemoveParent( bool deferRemovalFromList )
 	{
 		// No need to remove if nullptr
-		if ( mParent.Get( ) == nullptr )
+		if ( mHot->mParent.Get( ) == nullptr )
 		{
 			return;
 		}
 
 		// Remove child from parent
-		mParent.Get( )->DetachChild( GetHandle( ), deferRemovalFromList );
+		mHot->mParent.Get( )->DetachChild( GetHandle( ), deferRemovalFromList );
 	}
 
 	//---------------------------------------------------------------
@@ -801,13 +897,13 @@ namespace Enjon
 	//---------------------------------------------------------------
 	b8 Entity::HasParent( )
 	{
-		return ( mParent.Get( ) != nullptr );
+		return ( mHot->mParent.Get( ) != nullptr );
 	}
 
 	//---------------------------------------------------------------
 	b8 Entity::IsValid( )
 	{
-		return ( mState != EntityState::INVALID );
+		return ( mHot->mState != EntityState::INVALID );
 	}
 
 	//---------------------------------------------------------------
@@ -819,7 +915,7 @@ namespace Enjon
 			if ( ent )
 			{
 				// Set dirty to true
-				ent->mWorldTransformDirty = true;
+				ent->mHot->mWorldTransformDirty = true;
 
 				// Iterate through child's children to set their state dirty as well
 				ent->SetAllChildWorldTransformsDirty( );
@@ -831,9 +927,10 @@ namespace Enjon
 	{
 		// Calculate world transform
 		mWorldTransform = mLocalTransform;
+		mTransformVersion = NextTransformVersion( );
 		if ( HasParent( ) )
 		{
-			mWorldTransform *= mParent.Get( )->mWorldTransform;
+			mWorldTransform *= mHot->mParent.Get( )->mWorldTransform;
 		}
 
 		// Iterate through children and propagate down
@@ -858,7 +955,7 @@ namespace Enjon
 			Enjon::Entity* ent = c.Get( );
 			if ( ent )
 			{
-				ent->mWorldTransformDirty = true;
+				ent->mHot->mWorldTransformDirty = true;
 				ent->CalculateWorldTransform( );
 			}
 		}
@@ -899,9 +996,10 @@ namespace Enjon
 
 	Component* EntityManager::GetComponent( const EntityHandle& entity, const u32& ComponentID )
 	{
-		if ( mComponents.find( ComponentID ) != mComponents.end( ) )
+		ComponentWrapperBase* base = GetComponentBase( ComponentID );
+		if ( base && entity.Get( ) )
 		{
-			return mComponents[ ComponentID ]->GetComponent( entity.GetID( ) );
+			return base->GetComponent( entity.GetID( ) );
 		}
 
 		return nullptr;
@@ -919,28 +1017,100 @@ namespace Enjon
 
 	u32 EntityManager::FindNextAvailableID( )
 	{
-		// Iterate from current available id to MAX_ENTITIES
-		for ( u32 i = mNextAvailableID; i < MAX_ENTITIES; ++i )
+		// No entity slots left, so grow storage by a page
+		if ( mFreeEntityIDs.empty( ) )
 		{
-			if ( mEntities.at( i ).mState == EntityState::INVALID )
-			{
-				mNextAvailableID = i;
-				return mNextAvailableID;
-			}
+			AddEntityPage( );
 		}
 
-		// Iterate from 0 to mNextAvailableID
-		for ( u32 i = 0; i < mNextAvailableID; ++i )
+		u32 id = mFreeEntityIDs.back( );
+		mFreeEntityIDs.pop_back( );
+
+		return id;
+	}
+
+	//---------------------------------------------------------------
+
+	void EntityManager::AddEntityPage( )
+	{
+		// Ids of a new page are handed out in ascending order
+		u32 first = mEntities.AddPage( );
+		for ( u32 i = ENTITY_PAGE_SIZE; i > 0; --i )
 		{
-			if ( mEntities.at( i ).mState == EntityState::INVALID )
-			{
-				mNextAvailableID = i;
-				return mNextAvailableID;
-			}
+			mFreeEntityIDs.push_back( first + i - 1 );
+		}
+	}
+
+	//---------------------------------------------------------------
+
+	void EntityManager::ReserveEntities( const u32& count )
+	{
+		while ( mFreeEntityIDs.size( ) < count )
+		{
+			AddEntityPage( );
 		}
 
-		// Other wise return MAX_ENTITIES, since there are no entity slots left
-		return MAX_ENTITIES;
+		mMarkedForAdd.reserve( mMarkedForAdd.size( ) + count );
+	}
+
+	//---------------------------------------------------------------
+
+	void EntityManager::ReserveComponents( const MetaClass* compCls, const u32& count )
+	{
+		if ( !compCls )
+		{
+			return;
+		}
+
+		u32 compIdx = compCls->GetTypeId( );
+		if ( !ComponentBaseExists( compIdx ) )
+		{
+			RegisterComponent( compCls );
+		}
+
+		ComponentWrapperBase* base = GetComponentBase( compIdx );
+		if ( base )
+		{
+			base->Reserve( count, mEntities.GetCapacity( ) );
+		}
+	}
+
+	//---------------------------------------------------------------
+
+	EntityStorage::~EntityStorage( )
+	{
+		// Entities still read their hot data while being destroyed, so those pages go last
+		for ( auto& p : mPages )
+		{
+			delete[] p;
+			p = nullptr;
+		}
+
+		for ( auto& p : mHotPages )
+		{
+			delete[] p;
+			p = nullptr;
+		}
+
+		mPages.clear( );
+		mHotPages.clear( );
+	}
+
+	//---------------------------------------------------------------
+
+	u32 EntityStorage::AddPage( )
+	{
+		u32 first = GetCapacity( );
+		Entity* page = new Entity[ ENTITY_PAGE_SIZE ];
+		EntityHotData* hotPage = new EntityHotData[ ENTITY_PAGE_SIZE ];
+		for ( u32 i = 0; i < ENTITY_PAGE_SIZE; ++i )
+		{
+			page[ i ].mHot = &hotPage[ i ];
+		}
+
+		mPages.push_back( page );
+		mHotPages.push_back( hotPage );
+		return first;
 	}
 
 	//---------------------------------------------------------------
@@ -954,8 +1124,8 @@ namespace Enjon
 
 	void EntityManager::AddWorld( const World* world )
 	{
-		// Construct new entity vector for this world entry
-		mWorldEntityMap[ world ] = HashSet< Entity* >( );
+		// Construct new entity lists for this world entry
+		mWorldEntityMap[ world ] = WorldEntityList( );
 	}
 
 	//---------------------------------------------------------------
@@ -977,17 +1147,16 @@ namespace Enjon
 		// Grab next available id and assert that it's valid
 		u32 id = FindNextAvailableID( );
 
-		// Make sure if valid id ( not out of room )
-		assert( id < MAX_ENTITIES );
+		// Make sure if valid id
+		assert( id != INVALID_ENTITY_ID );
 
 		// Handle to return
 		Enjon::EntityHandle handle;
 
 		// Find entity in array and set values
-		Entity* entity = &mEntities.at( id );
-		handle.mID = id;
+		Entity* entity = mEntities.Get( id );
 		entity->mID = id;
-		entity->mState = EntityState::ACTIVE;
+		entity->mHot->mState = EntityState::ACTIVE;
 		entity->mUUID = UUID::GenerateUUID( );
 		entity->mWorld = world; 
 
@@ -997,6 +1166,10 @@ namespace Enjon
 		// Add to uuid map
 		AddToUUIDMap( entity ); 
 
+		// Handle carries the slot's current generation
+		handle.mID = id;
+		handle.mGeneration = entity->mHot->mGeneration;
+
 		// Return entity handle
 		return handle;
 	}
@@ -1013,14 +1186,8 @@ namespace Enjon
 			return;
 		}
 
-		String uuidStr = ent->GetUUID( ).ToString( );
-
-		// Not found, so add it
-		if ( mEntityUUIDMap.find( uuidStr ) == mEntityUUIDMap.end( ) )
-		{
-			// Add to map
-			mEntityUUIDMap[ ent->GetUUID( ).ToString( ) ] = ent; 
-		} 
+		// Only added if not found
+		mEntityUUIDMap.insert( std::make_pair( ent->GetUUID( ), ent ) ); 
 	}
 
 	//---------------------------------------------------------------
@@ -1034,19 +1201,13 @@ namespace Enjon
 			return;
 		} 
 
-		String uuidStr = ent->GetUUID( ).ToString( );
-
 		// Cannot delete uuid from other entity
-		if ( mEntityUUIDMap.find( uuidStr ) != mEntityUUIDMap.end( ) )
+		auto query = mEntityUUIDMap.find( ent->GetUUID( ) );
+		if ( query != mEntityUUIDMap.end( ) && query->second == ent )
 		{
-			if ( mEntityUUIDMap[ uuidStr ] != ent )
-			{
-				return;
-			}
+			// Erase from map
+			mEntityUUIDMap.erase( query );
 		}
-
-		// Erase from map
-		mEntityUUIDMap.erase( ent->GetUUID( ).ToString( ) );
 	}
 
 	//---------------------------------------------------------------
@@ -1061,12 +1222,11 @@ namespace Enjon
 		Vector<EntityHandle> entities;
 		if ( WorldExists( world ) )
 		{
-			for ( auto& e : mWorldEntityMap[ world ] )
+			const Vector< Entity* >& roots = mWorldEntityMap[ world ].mRoots;
+			entities.reserve( roots.size( ) );
+			for ( auto& e : roots )
 			{
-				if ( !e->HasParent( ) )
-				{
-					entities.push_back( e->GetHandle( ) );
-				}
+				entities.push_back( e->GetHandle( ) );
 			}
 		}
 
@@ -1077,11 +1237,10 @@ namespace Enjon
 
 	EntityHandle EntityManager::GetEntityByUUID( const UUID& uuid )
 	{
-		String uuidStr = uuid.ToString( );
-
-		if ( mEntityUUIDMap.find( uuidStr ) != mEntityUUIDMap.end( ) )
+		auto query = mEntityUUIDMap.find( uuid );
+		if ( query != mEntityUUIDMap.end( ) )
 		{
-			return mEntityUUIDMap[ uuidStr ];
+			return query->second;
 		}
 
 		return EntityHandle::Invalid( );
@@ -1123,9 +1282,24 @@ namespace Enjon
 
 	Entity* EntityManager::GetRawEntity( const u32& id )
 	{
-		if ( id < MAX_ENTITIES && mEntities.at( id ).mState != EntityState::INVALID )
+		const EntityHotData* hot = mEntities.GetHotData( id );
+		if ( hot && hot->mState != EntityState::INVALID )
+		{
+			return mEntities.Get( id );
+		}
+
+		return nullptr;
+	}
+
+	//---------------------------------------------------------------
+
+	Entity* EntityManager::GetRawEntity( const u32& id, const u32& generation )
+	{
+		// Only the hot data is read to validate, the entity record isn't touched unless the handle is live
+		const EntityHotData* hot = mEntities.GetHotData( id );
+		if ( hot && hot->mGeneration == generation && hot->mState != EntityState::INVALID )
 		{
-			return &mEntities.at( id );
+			return mEntities.Get( id );
 		}
 
 		return nullptr;
@@ -1154,7 +1328,7 @@ namespace Enjon
 		mMarkedForDestruction.push_back( entity.GetID( ) );
 
 		// Set entity to be invalid
-		entity.Get( )->mState = EntityState::INACTIVE; 
+		entity.Get( )->mHot->mState = EntityState::INACTIVE; 
 
 		// Remove from need initialization lists
 		RemoveFromNeedInitLists( entity );
@@ -1197,6 +1371,19 @@ namespace Enjon
 
 	void EntityManager::DestroyAll( )
 	{
+		// Unload each world in a single batched pass
+		Vector< const World* > worlds;
+		for ( auto& w : mWorldEntityMap )
+		{
+			worlds.push_back( w.first );
+		}
+
+		for ( auto& w : worlds )
+		{
+			UnloadWorld( w );
+		}
+
+		// Whatever is left isn't listed with a registered world
 		for ( auto& e : mActiveEntities )
 		{
 			e->Destroy( );
@@ -1207,10 +1394,183 @@ namespace Enjon
 			e->Destroy( );
 		}
 
+		// Free all components in bulk rather than entity by entity during cleanup
+		ReleaseDestroyedComponents( );
+
 		mActiveEntities.clear( );
 		mMarkedForAdd.clear( );
 		mNeedInitializationList.clear( );
 		mNeedStartList.clear( );
+		mTransformHierarchyDirty = true;
+	}
+
+	//==============================================================================
+
+	void EntityManager::UnloadWorld( const World* world )
+	{
+		auto query = mWorldEntityMap.find( world );
+		if ( query == mWorldEntityMap.end( ) )
+		{
+			return;
+		}
+
+		WorldEntityList& list = query->second;
+
+		// Gather listed and pending entities of world
+		Vector< Entity* > doomed;
+		doomed.reserve( list.mEntities.size( ) );
+		for ( auto& e : list.mEntities )
+		{
+			if ( !e->mIsArchetypeRoot )
+			{
+				doomed.push_back( e );
+			}
+		}
+		for ( auto& e : mMarkedForAdd )
+		{
+			if ( e->mWorld == world && e->mWorldIndex == INVALID_ENTITY_ID && !e->mIsArchetypeRoot )
+			{
+				doomed.push_back( e );
+			}
+		}
+
+		if ( doomed.empty( ) )
+		{
+			return;
+		}
+
+		// Flag doomed slots so every list below is filtered in one pass
+		Vector< u8 > isDoomed( mEntities.GetCapacity( ), 0 );
+		auto IsDoomed = [ & ]( u32 id )
+		{
+			return id < isDoomed.size( ) && isDoomed[ id ];
+		};
+
+		for ( auto& e : doomed )
+		{
+			isDoomed[ e->mID ] = 1;
+			RemoveFromUUIDMap( e );
+			e->mHot->mState = EntityState::INACTIVE;
+		}
+
+		auto IsDoomedComponent = [ & ]( Component* c )
+		{
+			Entity* ent = c ? c->GetEntity( ) : nullptr;
+			return ent && IsDoomed( ent->mID );
+		};
+		auto IsDoomedEntity = [ & ]( Entity* e )
+		{
+			return IsDoomed( e->mID );
+		};
+
+		mNeedInitializationList.erase( std::remove_if( mNeedInitializationList.begin( ), mNeedInitializationList.end( ), IsDoomedComponent ), mNeedInitializationList.end( ) );
+		mNeedStartList.erase( std::remove_if( mNeedStartList.begin( ), mNeedStartList.end( ), IsDoomedComponent ), mNeedStartList.end( ) );
+		mActiveEntities.erase( std::remove_if( mActiveEntities.begin( ), mActiveEntities.end( ), IsDoomedEntity ), mActiveEntities.end( ) );
+		mMarkedForAdd.erase( std::remove_if( mMarkedForAdd.begin( ), mMarkedForAdd.end( ), IsDoomedEntity ), mMarkedForAdd.end( ) );
+
+		// Slots are freed below, so stale destruction entries must not reach cleanup
+		mMarkedForDestruction.erase( std::remove_if( mMarkedForDestruction.begin( ), mMarkedForDestruction.end( ), IsDoomed ), mMarkedForDestruction.end( ) );
+
+		// Entities are no longer listed with world, so hierarchy changes below don't touch its lists
+		for ( auto& e : doomed )
+		{
+			e->mWorldIndex = INVALID_ENTITY_ID;
+			e->mWorldRootIndex = INVALID_ENTITY_ID;
+		}
+
+		// Compact world lists down to surviving archetype roots
+		auto CompactDenseList = [ & ]( Vector< Entity* >& entities, u32 Entity::* index )
+		{
+			u32 count = 0;
+			for ( auto& e : entities )
+			{
+				if ( !IsDoomed( e->mID ) )
+				{
+					e->*index = count;
+					entities[ count++ ] = e;
+				}
+			}
+			entities.resize( count );
+		};
+		CompactDenseList( list.mEntities, &Entity::mWorldIndex );
+		CompactDenseList( list.mRoots, &Entity::mWorldRootIndex );
+
+		// Defer graphics and physics list maintenance until all components are gone
+		GraphicsSubsystemContext* gfxContext = world->ConstCast< World >( )->GetContext< GraphicsSubsystemContext >( );
+		GraphicsScene* scene = gfxContext ? gfxContext->GetGraphicsScene( ) : nullptr;
+		PhysicsSubsystem* physics = EngineSubsystem( PhysicsSubsystem );
+
+		if ( scene )
+		{
+			scene->BeginBatchedRemoval( );
+		}
+		if ( physics )
+		{
+			physics->BeginBatchedRemoval( );
+		}
+
+		// Only components of this world's entities are freed, entities of other worlds awaiting cleanup keep theirs
+		ReleaseComponents( doomed );
+
+		for ( auto& e : doomed )
+		{
+			ObjectArchiver::ClearAllPropertyOverrides( e );
+
+			// Only links to entities that survive need undoing
+			if ( !IsDoomed( e->mHot->mParent.GetID( ) ) )
+			{
+				e->RemoveParent( );
+			}
+
+			for ( auto& c : e->mChildren )
+			{
+				if ( !IsDoomed( c.GetID( ) ) && c.Get( ) )
+				{
+					c.Get( )->RemoveParent( true );
+				}
+			}
+
+			if ( e->mColdData )
+			{
+				EntityHandle prototype = e->mColdData->mPrototypeEntity;
+				if ( !IsDoomed( prototype.GetID( ) ) )
+				{
+					e->RemovePrototypeEntity( );
+				}
+
+				for ( auto& i : e->GetInstancedEntities( ) )
+				{
+					if ( !IsDoomed( i.GetID( ) ) && i.Get( ) )
+					{
+						i.Get( )->RemovePrototypeEntity( );
+					}
+				}
+			}
+		}
+
+		// Reset and free slots only once all links have been read
+		for ( auto& e : doomed )
+		{
+			u32 id = e->mID;
+			e->ResetData( );
+			e->mHot->mParent = EntityHandle( );
+			e->mWorld = nullptr;
+
+			// Any outstanding handles to this slot are now stale
+			e->mHot->mGeneration++;
+			mFreeEntityIDs.push_back( id );
+		}
+
+		if ( scene )
+		{
+			scene->EndBatchedRemoval( );
+		}
+		if ( physics )
+		{
+			physics->EndBatchedRemoval( );
+		}
+
+		mTransformHierarchyDirty = true;
 	}
 
 	//==============================================================================
@@ -1222,12 +1582,73 @@ namespace Enjon
 
 	//==============================================================================
 
-	const HashSet< Entity* >& EntityManager::GetEntitiesByWorld( const World* world )
+	const Vector< Entity* >& EntityManager::GetEntitiesByWorld( const World* world )
 	{
 		// World must be registerd!
 		assert( WorldExists( world ) );
 
-		return mWorldEntityMap[ world ];
+		return mWorldEntityMap[ world ].mEntities;
+	}
+
+	//==============================================================================
+
+	const Vector< Entity* >& EntityManager::GetRootEntitiesByWorld( const World* world )
+	{
+		// World must be registerd!
+		assert( WorldExists( world ) );
+
+		return mWorldEntityMap[ world ].mRoots;
+	}
+
+	//==============================================================================
+
+	void EntityManager::InsertIntoDenseList( Vector< Entity* >& list, u32 Entity::* index, Entity* entity )
+	{
+		entity->*index = ( u32 )list.size( );
+		list.push_back( entity );
+	}
+
+	//==============================================================================
+
+	void EntityManager::EraseFromDenseList( Vector< Entity* >& list, u32 Entity::* index, Entity* entity )
+	{
+		u32 i = entity->*index;
+		assert( i < list.size( ) && list[ i ] == entity );
+
+		Entity* last = list.back( );
+		list[ i ] = last;
+		last->*index = i;
+		list.pop_back( );
+
+		entity->*index = INVALID_ENTITY_ID;
+	}
+
+	//==============================================================================
+
+	void EntityManager::UpdateWorldRootEntry( Entity* entity )
+	{
+		// Not registered with any world
+		if ( entity->mWorldIndex == INVALID_ENTITY_ID )
+		{
+			return;
+		}
+
+		auto query = mWorldEntityMap.find( entity->mWorld );
+		if ( query == mWorldEntityMap.end( ) )
+		{
+			return;
+		}
+
+		bool isRoot = !entity->HasParent( );
+		bool isListed = entity->mWorldRootIndex != INVALID_ENTITY_ID;
+		if ( isRoot && !isListed )
+		{
+			InsertIntoDenseList( query->second.mRoots, &Entity::mWorldRootIndex, entity );
+		}
+		else if ( !isRoot && isListed )
+		{
+			EraseFromDenseList( query->second.mRoots, &Entity::mWorldRootIndex, entity );
+		}
 	}
 
 	//==============================================================================
@@ -1250,6 +1671,8 @@ namespace Enjon
 			mActiveEntities.push_back( e );
 		}
 
+		mTransformHierarchyDirty = true;
+
 		// Clear the marked for add entities
 		mMarkedForAdd.clear( );
 	}
@@ -1261,35 +1684,33 @@ namespace Enjon
 		// Move through dirty list and remove from active entities
 		for ( auto& e : mMarkedForDestruction )
 		{
-			if ( e < MAX_ENTITIES )
-			{
-				Entity* ent = &mEntities.at( e );
+			Entity* ent = mEntities.Get( e );
 
-				if ( ent && ent->mState != EntityState::INVALID )
+			if ( ent && ent->mHot->mState != EntityState::INVALID )
+			{
+				// Destroy all components
+				for ( auto& c : ent->mComponents )
 				{
-					// Destroy all components
-					for ( auto& c : ent->mComponents )
+					auto comp = GetComponent( ent->GetHandle( ), c );
+					if ( comp )
 					{
-						auto comp = GetComponent( ent->GetHandle( ), c );
-						if ( comp )
-						{
-							// Call shutdown on component
-							comp->Shutdown( );
-							// Destroy the component
-							comp->Destroy( );
-							// Remove component from world
-							comp->RemoveFromWorld( );
-						}
+						// Call shutdown on component
+						comp->Shutdown( );
+						// Destroy the component
+						comp->Destroy( );
+						// Remove component from world
+						comp->RemoveFromWorld( );
 
 						// Free component memory
-						delete comp;
-						// Set to null
-						comp = nullptr;
+						mComponents[ c ]->FreeComponent( comp );
 					}
 
-					// Remove entity ( includes reset )
-					RemoveEntityUnsafe( ent );
+					// Set to null
+					comp = nullptr;
 				}
+
+				// Remove entity ( includes reset )
+				RemoveEntityUnsafe( ent );
 			}
 		}
 
@@ -1298,13 +1719,114 @@ namespace Enjon
 
 	//==================================================================================================
 
+	void EntityManager::ReleaseDestroyedComponents( )
+	{
+		for ( auto& idx : mRegisteredComponentTypes )
+		{
+			ComponentWrapperBase* base = mComponents[ idx ];
+			if ( base->IsEmpty( ) )
+			{
+				continue;
+			}
+
+			bool hasLiveComponents = false;
+			Vector< Component* > destroyed;
+
+			for ( auto& c : base->GetComponents( ) )
+			{
+				Entity* ent = c->GetEntity( );
+				if ( ent && ent->mHot->mState == EntityState::ACTIVE )
+				{
+					hasLiveComponents = true;
+					continue;
+				}
+
+				// Call shutdown on component
+				c->Shutdown( );
+				// Remove component from world
+				c->RemoveFromWorld( );
+
+				destroyed.push_back( c );
+			}
+
+			// Nothing left alive, so release entire pool at once
+			if ( !hasLiveComponents )
+			{
+				base->ReleaseAll( );
+			}
+			else
+			{
+				for ( auto& c : destroyed )
+				{
+					base->FreeComponent( c );
+				}
+			}
+		}
+	}
+
+	//==================================================================================================
+
+	void EntityManager::ReleaseComponents( const Vector< Entity* >& entities )
+	{
+		// Gather components by type straight from the entities, pools are never scanned
+		Vector< Vector< Component* > > released( mComponents.size( ) );
+		for ( auto& e : entities )
+		{
+			for ( auto& idx : e->mComponents )
+			{
+				Component* c = mComponents[ idx ]->GetComponent( e->mID );
+				if ( c )
+				{
+					released[ idx ].push_back( c );
+				}
+			}
+		}
+
+		for ( u32 idx = 0; idx < released.size( ); ++idx )
+		{
+			if ( released[ idx ].empty( ) )
+			{
+				continue;
+			}
+
+			for ( auto& c : released[ idx ] )
+			{
+				c->Shutdown( );
+				c->RemoveFromWorld( );
+			}
+
+			// Pool holds nothing but released components, so release it at once
+			ComponentWrapperBase* base = mComponents[ idx ];
+			if ( released[ idx ].size( ) == base->GetSize( ) )
+			{
+				base->ReleaseAll( );
+			}
+			else
+			{
+				for ( auto& c : released[ idx ] )
+				{
+					base->FreeComponent( c );
+				}
+			}
+		}
+	}
+
+	//==================================================================================================
+
 	void EntityManager::RemoveEntityUnsafe( Entity* entity )
 	{
+		u32 id = entity->mID;
+
 		// Reset the entity
 		entity->Reset( );
 
+		// Any outstanding handles to this slot are now stale
+		entity->mHot->mGeneration++;
+		mFreeEntityIDs.push_back( id );
+
 		// Remove from active entities
 		mActiveEntities.erase( std::remove( mActiveEntities.begin( ), mActiveEntities.end( ), entity ), mActiveEntities.end( ) ); 
+		mTransformHierarchyDirty = true;
 	}
 
 	//==================================================================================================
@@ -1316,9 +1838,15 @@ namespace Enjon
 			auto query = mWorldEntityMap.find( world );
 			if ( query != mWorldEntityMap.end( ) )
 			{
-				if ( mWorldEntityMap[ world ].find( entity ) == mWorldEntityMap[ world ].end( ) )
+				// Entity can only be listed with one world at a time
+				if ( entity->mWorldIndex != INVALID_ENTITY_ID && entity->mWorld != world )
+				{
+					RemoveEntityFromWorld( entity );
+				}
+
+				if ( entity->mWorldIndex == INVALID_ENTITY_ID )
 				{
-					mWorldEntityMap[ world ].insert( entity ); 
+					InsertIntoDenseList( query->second.mEntities, &Entity::mWorldIndex, entity );
 
 					// Add children to world
 					for ( auto& c : entity->GetChildren( ) )
@@ -1330,9 +1858,12 @@ namespace Enjon
 					for ( auto& c : entity->GetComponents( ) )
 					{
 						c->AddToWorld( world );
+						c->RefreshTickEntry( );
 					}
 
 					entity->mWorld = world; 
+
+					UpdateWorldRootEntry( entity );
 				}
 			}
 		}
@@ -1348,10 +1879,16 @@ namespace Enjon
 			auto query = mWorldEntityMap.find( world );
 			if ( query != mWorldEntityMap.end( ) )
 			{
-				// Erase entity from list if found
-				HashSet< Entity* >* ents = &mWorldEntityMap[ world ];
-				ents->erase( entity );
-				//ents->erase( std::remove( ents->begin( ), ents->end( ), entity ), ents->end( ) );
+				// Erase entity from lists if found
+				WorldEntityList& ents = query->second;
+				if ( entity->mWorldRootIndex != INVALID_ENTITY_ID )
+				{
+					EraseFromDenseList( ents.mRoots, &Entity::mWorldRootIndex, entity );
+				}
+				if ( entity->mWorldIndex != INVALID_ENTITY_ID )
+				{
+					EraseFromDenseList( ents.mEntities, &Entity::mWorldIndex, entity );
+				}
 
 				// Remove children from world as well
 				for ( auto& c : entity->GetChildren( ) )
@@ -1363,6 +1900,7 @@ namespace Enjon
 				for ( auto& c : entity->GetComponents( ) )
 				{
 					c->RemoveFromWorld( );
+					c->RefreshTickEntry( );
 				}
 
 				// Set world to null
@@ -1378,15 +1916,18 @@ namespace Enjon
 		auto query = mWorldEntityMap.find( world );
 		if ( query != mWorldEntityMap.end( ) )
 		{
-			// Destroy all entities in list
-			HashSet< Entity* >& ents = mWorldEntityMap[ world ];
-			for ( auto& e : ents )
+			// Destroy all entities in list, they're no longer listed with any world
+			WorldEntityList& ents = query->second;
+			for ( auto& e : ents.mEntities )
 			{
 				e->Destroy( );
+				e->mWorldIndex = INVALID_ENTITY_ID;
+				e->mWorldRootIndex = INVALID_ENTITY_ID;
 			}
 
-			// Clear list
-			ents.clear( );
+			// Clear lists
+			ents.mEntities.clear( );
+			ents.mRoots.clear( );
 		}
 
 		// Remove world from map
@@ -1398,14 +1939,14 @@ namespace Enjon
 	Result EntityManager::Initialize( )
 	{
 		// Set all components to null
-		for ( auto i = 0; i < mComponents.size( ); i++ )
+		for ( auto& c : mComponents )
 		{
-			mComponents.at( i ) = nullptr;
+			c = nullptr;
 		}
+		mRegisteredComponentTypes.clear( );
 
-		// Reset available id and then resize entity storage array
-		mNextAvailableID = 0;
-		mEntities.resize( MAX_ENTITIES ); 
+		// Entity storage pages are allocated on demand
+		mFreeEntityIDs.clear( );
 
 		// Register all engine level components with component array 
 		RegisterAllEngineComponents( );
@@ -1419,6 +1960,11 @@ namespace Enjon
 		mArchetypeWorld->SetUpdates< EntitySubsystemContext >( false );
 		mArchetypeWorld->SetUpdates< GraphicsSubsystemContext >( false );
 
+		// One command buffer for main thread and each job worker
+		JobSystem* jobSystem = EngineSubsystem( JobSystem );
+		mCommandBuffers.clear( );
+		mCommandBuffers.resize( ( jobSystem ? jobSystem->GetWorkerCount( ) : 0 ) + 1 );
+
 		return Result::SUCCESS;
 	}
 
@@ -1426,16 +1972,23 @@ namespace Enjon
 
 	void EntityManager::Update( const f32 dt )
 	{
+		// Start a new change version for all component types
+		for ( auto& idx : mRegisteredComponentTypes )
+		{
+			mComponents[ idx ]->AdvanceChangeVersion( );
+		}
+
 		// Clean any entities that were marked for destruction
 		Cleanup( );
 
 		// Add all new entities into active entities
 		for ( auto& e : mMarkedForAdd )
 		{
-			if ( e->mState == EntityState::ACTIVE )
+			if ( e->mHot->mState == EntityState::ACTIVE )
 			{
 				// Push back entity
 				mActiveEntities.push_back( e );
+				mTransformHierarchyDirty = true;
 
 				// Push back entity into its world map vector
 				AddEntityToWorld( e, e->GetWorld( )->ConstCast< World >( ) ); 
@@ -1471,10 +2024,131 @@ namespace Enjon
 			mNeedStartList.clear( );
 		}
 
-		// Update all component systems
-		for ( auto& system : mComponents )
+		// Bring cached world transforms up to date so components only ever read them
+		UpdateAllActiveTransforms( dt );
+
+		// Update all component systems, running those without conflicting access concurrently
+		mScheduler.Run( mRegisteredComponentTypes, mComponents, EngineSubsystem( JobSystem ) );
+
+		// Sync point, make any structural changes recorded during component updates
+		PlaybackCommandBuffers( );
+	}
+
+	//==================================================================================================
+
+	EntityCommandBuffer* EntityManager::GetCommandBuffer( )
+	{
+		u32 threadIndex = JobSystem::GetCurrentThreadIndex( );
+		assert( threadIndex < mCommandBuffers.size( ) );
+		return &mCommandBuffers.at( threadIndex );
+	}
+
+	//==================================================================================================
+
+	void EntityManager::PlaybackCommandBuffers( )
+	{
+		struct CommandRef
+		{
+			u32 mSortKey;
+			u32 mBuffer;
+			u32 mCommand;
+		};
+
+		// Take all recorded commands so anything recorded during playback waits for next sync point
+		Vector< EntityCommandBuffer > buffers( mCommandBuffers.size( ) );
+		Vector< CommandRef > order;
+		for ( u32 b = 0; b < mCommandBuffers.size( ); ++b )
+		{
+			std::swap( buffers[ b ].mCommands, mCommandBuffers[ b ].mCommands );
+			std::swap( buffers[ b ].mDeferredWorlds, mCommandBuffers[ b ].mDeferredWorlds );
+			mCommandBuffers[ b ].Clear( );
+
+			for ( u32 c = 0; c < buffers[ b ].mCommands.size( ); ++c )
+			{
+				order.push_back( { buffers[ b ].mCommands[ c ].mSortKey, b, c } );
+			}
+		}
+
+		if ( order.empty( ) )
 		{
-			system.second->Update( );
+			return;
+		}
+
+		// Buffers were gathered in thread order and commands in record order, so a stable sort keeps both for equal keys
+		std::stable_sort( order.begin( ), order.end( ), [ ]( const CommandRef& a, const CommandRef& b )
+		{
+			return a.mSortKey < b.mSortKey;
+		} );
+
+		// Deferred entities are allocated the first time a played back command refers to them
+		Vector< Vector< EntityHandle > > deferred( buffers.size( ) );
+		for ( u32 b = 0; b < buffers.size( ); ++b )
+		{
+			deferred[ b ].resize( buffers[ b ].mDeferredWorlds.size( ) );
+		}
+
+		for ( auto& ref : order )
+		{
+			const EntityCommand& command = buffers[ ref.mBuffer ].mCommands[ ref.mCommand ];
+			const EntityCommandTarget& target = command.mTarget;
+
+			EntityHandle handle;
+			if ( target.mDeferredIndex != INVALID_ENTITY_ID )
+			{
+				EntityHandle& created = deferred[ ref.mBuffer ][ target.mDeferredIndex ];
+				if ( created.GetID( ) == INVALID_ENTITY_ID )
+				{
+					created = Allocate( buffers[ ref.mBuffer ].mDeferredWorlds[ target.mDeferredIndex ] );
+				}
+				handle = created;
+			}
+			else
+			{
+				Entity* ent = GetRawEntity( target.mID, target.mGeneration );
+				handle = ent ? ent->GetHandle( ) : EntityHandle::Invalid( );
+			}
+
+			// Entity was destroyed before command got to it, either already cleaned up or by an earlier command
+			if ( !handle.Get( ) || handle.Get( )->GetState( ) == EntityState::INACTIVE )
+			{
+				continue;
+			}
+
+			switch ( command.mType )
+			{
+				case EntityCommandType::CreateEntity:
+				{
+					// Allocated when resolved above
+				} break;
+
+				case EntityCommandType::DestroyEntity:
+				{
+					Destroy( handle );
+				} break;
+
+				case EntityCommandType::AddComponent:
+				{
+					Component* comp = AddComponent( command.mClass, handle );
+					if ( comp && command.mApply )
+					{
+						command.mApply( comp );
+					}
+				} break;
+
+				case EntityCommandType::RemoveComponent:
+				{
+					RemoveComponent( command.mClass, handle );
+				} break;
+
+				case EntityCommandType::SetProperty:
+				{
+					Component* comp = GetComponent( command.mClass, handle );
+					if ( comp && command.mApply )
+					{
+						command.mApply( comp );
+					}
+				} break;
+			}
 		}
 	}
 
@@ -1482,7 +2156,7 @@ namespace Enjon
 
 	void EntityManager::LateUpdate( f32 dt )
 	{
-		// Clean any entities that were marked for destruction
+		// Propagate any transforms changed during component updates
 		UpdateAllActiveTransforms( dt );
 	}
 
@@ -1490,6 +2164,9 @@ namespace Enjon
 
 	Result EntityManager::Shutdown( )
 	{
+		// Drop anything recorded after the last sync point
+		mCommandBuffers.clear( );
+
 		// Destroy world
 		if ( mArchetypeWorld )
 		{
@@ -1497,22 +2174,29 @@ namespace Enjon
 			mArchetypeWorld = nullptr;
 		}
 
-		// Detach all components from entities
-		for ( u32 i = 0; i < MAX_ENTITIES; ++i )
+		// Detach all components from live entities
+		for ( auto& list : { &mActiveEntities, &mMarkedForAdd } )
 		{
-			mEntities.at( i ).mIsArchetypeRoot = false;
-			Destroy( mEntities.at( i ).GetHandle( ) );
+			for ( auto& e : *list )
+			{
+				e->mIsArchetypeRoot = false;
+				Destroy( e->GetHandle( ) );
+			}
 		}
 
-		// Force destroy all entities and their components
+		// Release all component pools at once
+		ReleaseDestroyedComponents( );
+
+		// Force destroy all entities
 		ForceCleanup( );
 
 		// Deallocate all components
 		for ( auto& c : mComponents )
 		{
-			delete c.second;
-			c.second = nullptr;
+			delete c;
+			c = nullptr;
 		}
+		mRegisteredComponentTypes.clear( );
 
 		// Clear all lists to free memory
 		mNeedStartList.clear( );
@@ -1520,6 +2204,8 @@ namespace Enjon
 		mNeedInitializationList.clear( );
 		mMarkedForAdd.clear( );
 		mMarkedForDestruction.clear( );
+		mTransformHierarchy.clear( );
+		mTransformHierarchyLevels.clear( );
 
 		return Result::SUCCESS;
 	}
@@ -1540,9 +2226,138 @@ namespace Enjon
 
 	//================================================================================================== 
 
+	void EntityManager::SetTransformHierarchyDirty( )
+	{
+		mTransformHierarchyDirty = true;
+	}
+
+	//================================================================================================== 
+
+	void EntityManager::RebuildTransformHierarchy( )
+	{
+		mTransformHierarchy.clear( );
+		mTransformHierarchyLevels.clear( );
+
+		// Roots make up the first level
+		for ( auto& e : mActiveEntities )
+		{
+			if ( !e->HasParent( ) )
+			{
+				mTransformHierarchy.push_back( { e, e->mHot, TransformHierarchyNode::InvalidParent } );
+			}
+		}
+
+		// Breadth first, so every parent is placed in the array before its children
+		u32 levelBegin = 0;
+		while ( levelBegin < mTransformHierarchy.size( ) )
+		{
+			u32 levelEnd = ( u32 )mTransformHierarchy.size( );
+			mTransformHierarchyLevels.push_back( levelBegin );
+
+			for ( u32 i = levelBegin; i < levelEnd; ++i )
+			{
+				for ( auto& c : mTransformHierarchy[ i ].mEntity->mChildren )
+				{
+					Entity* child = c.Get( );
+					if ( child && child->mHot->mState != EntityState::INVALID )
+					{
+						mTransformHierarchy.push_back( { child, child->mHot, i } );
+					}
+				}
+			}
+
+			levelBegin = levelEnd;
+		}
+
+		mTransformHierarchyDirty = false;
+	}
+
+	//================================================================================================== 
+
 	void EntityManager::UpdateAllActiveTransforms( f32 dt )
 	{
-		// Does nothing for now
+		if ( mTransformHierarchyDirty )
+		{
+			RebuildTransformHierarchy( );
+		}
+
+		// Everything recalculated in this pass shares one transform version
+		u32 version = NextTransformVersion( );
+
+		u32 hierarchySize = ( u32 )mTransformHierarchy.size( );
+		if ( mPropagationLocal.GetCount( ) < hierarchySize )
+		{
+			mPropagationLocal.Resize( hierarchySize );
+			mPropagationParent.Resize( hierarchySize );
+		}
+
+		// Entities within a level never depend on each other, only on the level above
+		auto propagate = [ & ]( const u32& begin, const u32& end )
+		{
+			// Dirty children are packed into the streams from begin, composed in bulk and written back in the same order
+			u32 packedEnd = begin;
+			for ( u32 i = begin; i < end; ++i )
+			{
+				const TransformHierarchyNode& node = mTransformHierarchy[ i ];
+
+				// Dirty flag is set on all descendants as well, so clean entities are skipped without touching their record
+				if ( !node.mHot->mWorldTransformDirty )
+				{
+					continue;
+				}
+
+				Entity* ent = node.mEntity;
+				if ( node.mParentIndex == TransformHierarchyNode::InvalidParent )
+				{
+					ent->mWorldTransform = ent->mLocalTransform;
+					node.mHot->mWorldTransformDirty = false;
+					ent->mTransformVersion = version;
+					continue;
+				}
+
+				mPropagationLocal.Set( packedEnd, ent->mLocalTransform );
+				mPropagationParent.Set( packedEnd, mTransformHierarchy[ node.mParentIndex ].mEntity->mWorldTransform );
+				packedEnd++;
+			}
+
+			TransformStream::Compose( mPropagationLocal, mPropagationParent, mPropagationLocal, begin, packedEnd );
+
+			// Roots were cleaned above, so only the packed children are still dirty
+			u32 packed = begin;
+			for ( u32 i = begin; i < end; ++i )
+			{
+				const TransformHierarchyNode& node = mTransformHierarchy[ i ];
+				if ( !node.mHot->mWorldTransformDirty )
+				{
+					continue;
+				}
+
+				Entity* ent = node.mEntity;
+				ent->mWorldTransform = mPropagationLocal.Get( packed++ );
+				node.mHot->mWorldTransformDirty = false;
+				ent->mTransformVersion = version;
+			}
+		};
+
+		JobSystem* jobSystem = EngineSubsystem( JobSystem );
+
+		for ( u32 l = 0; l < mTransformHierarchyLevels.size( ); ++l )
+		{
+			u32 begin = mTransformHierarchyLevels[ l ];
+			u32 end = l + 1 < mTransformHierarchyLevels.size( ) ? mTransformHierarchyLevels[ l + 1 ] : ( u32 )mTransformHierarchy.size( );
+
+			if ( jobSystem && end - begin > TRANSFORM_PROPAGATION_BATCH_SIZE )
+			{
+				jobSystem->ParallelFor( end - begin, TRANSFORM_PROPAGATION_BATCH_SIZE, [ & ]( const u32& b, const u32& e )
+				{
+					propagate( begin + b, begin + e );
+				} );
+			}
+			else
+			{
+				propagate( begin, end );
+			}
+		}
 	}
 
 	//========================================================================================================================
@@ -1550,7 +2365,41 @@ namespace Enjon
 	void EntityManager::RegisterComponent( const MetaClass* cls )
 	{
 		u32 index = cls->GetTypeId( );
-		mComponents[ index ] = new ComponentArray( );
+
+		// Already registered
+		if ( ComponentBaseExists( index ) )
+		{
+			return;
+		}
+
+		// Flat array indexed directly by type id
+		if ( index >= mComponents.size( ) )
+		{
+			mComponents.resize( index + 1, nullptr );
+		}
+
+		mComponents[ index ] = new ComponentArray( cls );
+		mRegisteredComponentTypes.push_back( index );
+
+		// Type keeps its bit if it was registered before, types past what a mask holds get none
+		if ( index >= mComponentMasks.size( ) )
+		{
+			mComponentMasks.resize( index + 1, 0 );
+		}
+		if ( !mComponentMasks[ index ] && mComponentMaskBitCount < 64 )
+		{
+			mComponentMasks[ index ] = 1ull << mComponentMaskBitCount++;
+		}
+
+		// Read / write access used for scheduling updates
+		mScheduler.RegisterAccess( cls );
+	}
+
+	//========================================================================================================================
+
+	void EntityManager::SetComponentAccess( const MetaClass* compCls, const Vector< const MetaClass* >& reads, const Vector< const MetaClass* >& writes )
+	{
+		mScheduler.SetAccess( compCls, reads, writes );
 	}
 
 	//========================================================================================================================
@@ -1566,7 +2415,9 @@ namespace Enjon
 		if ( ComponentBaseExists( index ) && mComponents[ index ]->IsEmpty( ) )
 		{
 			ComponentWrapperBase* base = mComponents[ index ];
-			mComponents.erase( index );
+			mComponents[ index ] = nullptr;
+			mRegisteredComponentTypes.erase( std::remove( mRegisteredComponentTypes.begin( ), mRegisteredComponentTypes.end( ), index ), mRegisteredComponentTypes.end( ) );
+			mScheduler.RemoveAccess( cls );
 			delete base;
 			base = nullptr;
 		}
@@ -1590,7 +2441,8 @@ namespace Enjon
 			RegisterComponent( compCls );
 		}
 
-		assert( mComponents.at( compIdx ) != nullptr );
+		ComponentWrapperBase* base = GetComponentBase( compIdx );
+		assert( base != nullptr );
 
 		// Entity id
 		u32 eid = entity->GetID( );
@@ -1598,11 +2450,9 @@ namespace Enjon
 		// If component exists, return it
 		if ( entity->HasComponent( compCls ) )
 		{
-			return mComponents.at( compIdx )->GetComponent( entity->mID );
+			return base->GetComponent( entity->mID );
 		}
 
-		ComponentWrapperBase* base = mComponents[ compIdx ];
-
 		// Create new component and place into map
 		Component* component = base->AddComponent( compCls, eid );
 		if ( component )
@@ -1615,6 +2465,7 @@ namespace Enjon
 
 			// Get component ptr and push back into entity components
 			entity->mComponents.push_back( compIdx );
+			entity->mHot->mComponentMask |= GetComponentMask( compIdx );
 
 			// Push back for need initilization and start
 			mNeedInitializationList.push_back( component );
@@ -1661,9 +2512,10 @@ namespace Enjon
 			// Remove from entity component list
 			auto comps = &entity.Get( )->mComponents;
 			comps->erase( std::remove( comps->begin( ), comps->end( ), compCls->GetTypeId( ) ), comps->end( ) );
+			entity.Get( )->mHot->mComponentMask &= ~GetComponentMask( compCls->GetTypeId( ) );
 
 			// Free memory of component
-			delete comp;
+			mComponents[ compCls->GetTypeId( ) ]->FreeComponent( comp );
 			// Set to null
 			comp = nullptr;
 		}
@@ -1673,7 +2525,23 @@ namespace Enjon
 
 	bool EntityManager::ComponentBaseExists( const u32& compIdx )
 	{
-		return ( mComponents.find( compIdx ) != mComponents.end( ) );
+		return ( GetComponentBase( compIdx ) != nullptr );
+	}
+
+	//=========================================================================================
+
+	const ComponentPoolStats* EntityManager::GetComponentPoolStats( const MetaClass* compCls ) const
+	{
+		ComponentWrapperBase* base = compCls ? GetComponentBase( compCls->GetTypeId( ) ) : nullptr;
+		return base ? &base->GetPoolStats( ) : nullptr;
+	}
+
+	//=========================================================================================
+
+	const ComponentChangeStats* EntityManager::GetComponentChangeStats( const MetaClass* compCls ) const
+	{
+		ComponentWrapperBase* base = compCls ? GetComponentBase( compCls->GetTypeId( ) ) : nullptr;
+		return base ? &base->GetChangeStats( ) : nullptr;
 	}
 
 	//=========================================================================================
@@ -1681,9 +2549,9 @@ namespace Enjon
 	Vector<const MetaClass*> EntityManager::GetComponentMetaClassList( )
 	{
 		Vector< const MetaClass* > metaClassList;
-		for ( auto& c : mComponents )
+		for ( auto& c : mRegisteredComponentTypes )
 		{
-			const MetaClass* cls = Object::GetClass( c.first );
+			const MetaClass* cls = Object::GetClass( c );
 			if ( cls )
 			{
 				metaClassList.push_back( cls );
@@ -1760,26 +2628,17 @@ namespace Enjon
 			world = Engine::GetInstance( )->GetWorld( );
 		}
 
-		// Use to serialize entity data for new entity
-		ByteBuffer buffer;
-
 		// Set up the handle using the other
 		if ( entity.Get( ) )
 		{
 			// Get entities
 			Entity* sourceEnt = entity.Get( );
 
-			// Serialize entity into buffer
-			EntityArchiver::Serialize( entity, &buffer );
-
-			// Deserialize into new entity
-			EntityHandle newHandle = EntityArchiver::Deserialize( &buffer, world );
+			// Clone entity hierarchy into new entity ( all cloned entities get unique UUIDs )
+			EntityHandle newHandle = EntityArchiver::Clone( entity, world );
 
 			// Destination entity
 			Entity* destEnt = newHandle.Get( );
-
-			// Ensure that all UUIDs are unique
-			RecurisvelyGenerateNewUUIDs( destEnt ); 
  
 			// Cache off local transform of destination entity before parenting
 			Transform localTrans = destEnt->GetLocalTransform( );
@@ -1810,33 +2669,18 @@ namespace Enjon
 			world = Engine::GetInstance( )->GetWorld( );
 		}
 
-		// Use to serialize entity data for new entity
-		ByteBuffer buffer;
-
 		// Set up the handle using the other
 		if ( entity.Get( ) )
 		{
 			// Get entities
 			Entity* sourceEnt = entity.Get( );
 
-			// Serialize entity into buffer
-			EntityArchiver::Serialize( entity, &buffer );
-
-			// Deserialize into new entity
-			EntityHandle newHandle = EntityArchiver::Deserialize( &buffer, world, true );
+			// Clone entity hierarchy into new entity ( all cloned entities get unique UUIDs )
+			EntityHandle newHandle = EntityArchiver::Clone( entity, world, true );
 
 			// Destination entity
 			Entity* destEnt = newHandle.Get( );
 
-			// Construct new UUID for entity
-			destEnt->SetUUID( UUID::GenerateUUID( ) );
-
-			// Ensure that all UUIDs are unique
-			for ( auto& c : destEnt->GetChildren( ) )
-			{
-				RecurisvelyGenerateNewUUIDs( c );
-			}
-
 			// Set all prototype entities
 			RecursivelySetPrototypeEntities( sourceEnt, destEnt );
 
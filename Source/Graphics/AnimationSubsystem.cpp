@@ -3,6 +3,7 @@
 
 #include "Graphics/AnimationSubsystem.h"
 #include "Entity/Components/SkeletalAnimationComponent.h"
+#include "Entity/Components/SkeletalMeshComponent.h"
 #include "Entity/EntityManager.h"
 #include "SubsystemCatalog.h"
 #include "Engine.h"
@@ -21,18 +22,13 @@ namespace Enjon
 	void AnimationSubsystem::Update( const f32 dT )
 	{
 		EntityManager* em = EngineSubsystem( EntityManager );
-		Vector< Component* > comps = em->GetAllComponentsOfType< SkeletalAnimationComponent >( ); 
-		for ( auto& c : comps )
+
+		// Each entity's animation only touches its own components, so calculate all of them in parallel
+		em->Query< SkeletalAnimationComponent, SkeletalMeshComponent >( ).ParallelForEach( [ ]( Entity* ent, SkeletalAnimationComponent& sac, SkeletalMeshComponent& smc )
 		{
-			// Cast to skeletal animation component
-			SkeletalAnimationComponent* sac = c->ConstCast< SkeletalAnimationComponent >( );
-
-			if ( sac )
-			{
-				// Calculate transforms for this frame
-				sac->UpdateAndCalculateTransforms(); 
-			} 
-		}
+			// Calculate transforms for this frame
+			sac.UpdateAndCalculateTransforms( &smc ); 
+		} );
 	}
 
 	//==========================================================================
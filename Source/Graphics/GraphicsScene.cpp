@@ -66,29 +66,6 @@ namespace Enjon
 
 	//====================================================================================================
 
-	void GraphicsScene::SortStaticMeshRenderables( RenderableSortType type )
-	{
-		switch( type )
-		{
-			case RenderableSortType::MATERIAL:
-			{
-				std::stable_sort(mSortedStaticMeshRenderables.begin(), mSortedStaticMeshRenderables.end(), CompareMaterial);
-			} 
-			break;
-
-			case RenderableSortType::DEPTH:
-			{
-				std::stable_sort(mSortedStaticMeshRenderables.begin(), mSortedStaticMeshRenderables.end(), CompareDepth);
-			}
-			break;
-
-			default:
-			case RenderableSortType::NONE: break;
-		} 
-	}
-
-	//====================================================================================================
-
 	Camera* GraphicsScene::GetActiveCamera( )
 	{
 		if ( !mActiveCamera )
@@ -118,7 +95,11 @@ namespace Enjon
 	const Vector<StaticMeshRenderable*>& GraphicsScene::GetNonDepthTestedStaticMeshRenderables( )
 	{
 		// Sort by depth to camera
-		std::stable_sort( mNonDepthTestedStaticMeshRenderables.begin( ), mNonDepthTestedStaticMeshRenderables.end( ), CompareDepth );
+		v3 camPos = EngineSubsystem( GraphicsSubsystem )->GetGraphicsSceneCamera( )->GetPosition( );
+		std::stable_sort( mNonDepthTestedStaticMeshRenderables.begin( ), mNonDepthTestedStaticMeshRenderables.end( ), [ & ]( Renderable* a, Renderable* b )
+		{
+			return ( camPos - a->GetPosition( ) ).Length( ) < ( camPos - b->GetPosition( ) ).Length( );
+		} );
 
 		return mNonDepthTestedStaticMeshRenderables;
 	} 
@@ -158,8 +139,11 @@ namespace Enjon
 			renderable->SetGraphicsScene(nullptr);
 			mSkeletalMeshRenderables.erase(renderable);
 
-			// Remove renderable from sorted list
-			mSortedSkeletalMeshRenderables.erase( std::remove( mSortedSkeletalMeshRenderables.begin( ), mSortedSkeletalMeshRenderables.end( ), renderable ), mSortedSkeletalMeshRenderables.end( ) );
+			// Remove renderable from sorted list, deferred while batching
+			if ( !mBatchedRemoval )
+			{
+				mSortedSkeletalMeshRenderables.erase( std::remove( mSortedSkeletalMeshRenderables.begin( ), mSortedSkeletalMeshRenderables.end( ), renderable ), mSortedSkeletalMeshRenderables.end( ) );
+			}
 
 			// Sort renderables
 			//SortRenderables( );
@@ -194,8 +178,11 @@ namespace Enjon
 			renderable->SetGraphicsScene(nullptr);
 			mStaticMeshRenderables.erase(renderable);
 
-			// Remove renderable from sorted list
-			mSortedStaticMeshRenderables.erase( std::remove( mSortedStaticMeshRenderables.begin( ), mSortedStaticMeshRenderables.end( ), renderable ), mSortedStaticMeshRenderables.end( ) );
+			// Remove renderable from sorted list, deferred while batching
+			if ( !mBatchedRemoval )
+			{
+				mSortedStaticMeshRenderables.erase( std::remove( mSortedStaticMeshRenderables.begin( ), mSortedStaticMeshRenderables.end( ), renderable ), mSortedStaticMeshRenderables.end( ) );
+			}
 
 			// Sort renderables
 			//SortRenderables( );
@@ -204,6 +191,36 @@ namespace Enjon
 
 	//====================================================================================================
 
+	void GraphicsScene::BeginBatchedRemoval( )
+	{
+		mBatchedRemoval = true;
+	}
+
+	//====================================================================================================
+
+	void GraphicsScene::EndBatchedRemoval( )
+	{
+		if ( !mBatchedRemoval )
+		{
+			return;
+		}
+
+		mBatchedRemoval = false;
+
+		// Anything no longer registered with the scene was removed during the batch
+		mSortedStaticMeshRenderables.erase( std::remove_if( mSortedStaticMeshRenderables.begin( ), mSortedStaticMeshRenderables.end( ), [ & ]( StaticMeshRenderable* r )
+		{
+			return mStaticMeshRenderables.find( r ) == mStaticMeshRenderables.end( );
+		} ), mSortedStaticMeshRenderables.end( ) );
+
+		mSortedSkeletalMeshRenderables.erase( std::remove_if( mSortedSkeletalMeshRenderables.begin( ), mSortedSkeletalMeshRenderables.end( ), [ & ]( SkeletalMeshRenderable* r )
+		{
+			return mSkeletalMeshRenderables.find( r ) == mSkeletalMeshRenderables.end( );
+		} ), mSortedSkeletalMeshRenderables.end( ) );
+	}
+
+	//====================================================================================================
+
 	void GraphicsScene::AddNonDepthTestedStaticMeshRenderable( StaticMeshRenderable* renderable )
 	{
 		auto query = std::find( mNonDepthTestedStaticMeshRenderables.begin( ), mNonDepthTestedStaticMeshRenderables.end( ), renderable );
@@ -362,47 +379,6 @@ namespace Enjon
 		mAmbientSettings.mIntensity = color.a;
 	}
 
-	//==================================================================================================
-
-	bool GraphicsScene::CompareDepth(Renderable* a, Renderable* b)
-	{
-		// Get camera position
-		GraphicsSubsystem* gfx = EngineSubsystem( GraphicsSubsystem );
-		v3 camPos = gfx->GetGraphicsSceneCamera()->GetPosition();
-
-		// Get a pos
-		v3 aPos = a->GetPosition();
-		// Get b pos
-		v3 bPos = b->GetPosition();
-
-		f32 aDist = (camPos - aPos).Length();
-		f32 bDist = (camPos - bPos).Length();
-
-		return aDist < bDist;
-	}
-
-	//==================================================================================================
-
-	// TODO(): Come up with better way to compare materials
-	bool GraphicsScene::CompareMaterial(Renderable* a, Renderable* b)
-	{
-		// Need a good metric for comparing materials by shader program ids...
-		if ( a && b )
-		{
-			u32 pA = a->GetMaterial( 0 )->GetShaderGraph( )->GetShader( Enjon::ShaderPassType::Deferred_StaticGeom )->GetProgramID( );
-			u32 pB = a->GetMaterial( 0 )->GetShaderGraph( )->GetShader( Enjon::ShaderPassType::Deferred_StaticGeom )->GetProgramID( );
-			return pA > pB;
-		}
-
-		return false;
-
-		// TODO(): Set this up to where materials have a unique id and sort by that
-		//AssetHandle<Texture> texA = a->GetMaterial()->GetTexture(TextureSlotType::Albedo);
-		//AssetHandle<Texture> texB = b->GetMaterial()->GetTexture(TextureSlotType::Albedo);
-
-		//return texA.Get()->GetTextureId() > texB.Get()->GetTextureId();
-	}
-
 	//================================================================================================== 
 }
 
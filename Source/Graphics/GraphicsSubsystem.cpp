@@ -32,6 +32,7 @@
 #include "Graphics/StaticMeshRenderable.h"
 #include "Graphics/SkeletalMeshRenderable.h"
 #include "Base/World.h"
+#include "System/JobSystem.h"
 
 #include <string>
 #include <cassert>
@@ -136,6 +137,13 @@ namespace Enjon
 
 	//======================================================================================================
 
+	const RenderVisibleSet& GraphicsSubsystemContext::GetVisibleSet( ) const
+	{
+		return mVisibleSet;
+	}
+
+	//======================================================================================================
+
 	GraphicsScene* GraphicsSubsystem::GetGraphicsScene( )
 	{
 		World* mainWorld = Engine::GetInstance( )->GetWorld( );
@@ -278,6 +286,12 @@ namespace Enjon
 		// Initialize debug drawing
 		InitDebugDrawing( );
 
+		// Frame uniform block shared by all shader graph shaders
+		glGenBuffers( 1, &mFrameUniformBuffer );
+		glBindBuffer( GL_UNIFORM_BUFFER, mFrameUniformBuffer );
+		glBufferData( GL_UNIFORM_BUFFER, sizeof( FrameUniformBlock ), NULL, GL_DYNAMIC_DRAW );
+		glBindBuffer( GL_UNIFORM_BUFFER, 0 );
+
 		return Result::SUCCESS;
 	}
 
@@ -308,6 +322,10 @@ namespace Enjon
 		// Free all memory for render targets / frame buffers
 		FreeAllFrameBuffers( );
 
+		// Free frame uniform buffer
+		glDeleteBuffers( 1, &mFrameUniformBuffer );
+		mFrameUniformBuffer = 0;
+
 		// Shutdown shader manager
 		ShaderManager::DeleteShaders( );
 
@@ -842,6 +860,93 @@ namespace Enjon
 
 	//======================================================================================================
 	
+	void GraphicsSubsystem::UpdateFrameUniforms( const Camera* camera, const Mat4x4& previousViewProjection, const f32& worldTime )
+	{
+		static_assert( sizeof( FrameUniformBlock ) == 144, "FrameUniformBlock must match the std140 layout of the shader block." );
+
+		FrameUniformBlock block;
+		block.mViewProjection = camera->GetViewProjection( );
+		block.mPreviousViewProjection = previousViewProjection;
+		block.mViewPositionWorldSpace = camera->GetPosition( );
+		block.mWorldTime = worldTime;
+
+		glBindBuffer( GL_UNIFORM_BUFFER, mFrameUniformBuffer );
+		glBufferSubData( GL_UNIFORM_BUFFER, 0, sizeof( FrameUniformBlock ), &block );
+		glBindBuffer( GL_UNIFORM_BUFFER, 0 );
+		glBindBufferBase( GL_UNIFORM_BUFFER, FRAME_UNIFORM_BLOCK_BINDING, mFrameUniformBuffer );
+	}
+
+	//======================================================================================================
+
+	void GraphicsSubsystem::CullRenderables( GraphicsSubsystemContext* ctx, const Camera* camera )
+	{
+		GraphicsScene* scene = ctx->GetGraphicsScene( );
+		const Vector< StaticMeshRenderable* >& staticMeshRenderables = scene->GetStaticMeshRenderables( );
+		const Vector< SkeletalMeshRenderable* >& skeletalMeshRenderables = scene->GetSkeletalMeshRenderables( );
+
+		RenderVisibleSet& visibleSet = ctx->mVisibleSet;
+		visibleSet.mStaticMeshRenderables.clear( );
+		visibleSet.mSkeletalMeshRenderables.clear( );
+
+		// Static renderables first, then skeletal, in one index space
+		u32 staticCount = ( u32 )staticMeshRenderables.size( );
+		u32 count = staticCount + ( u32 )skeletalMeshRenderables.size( );
+
+		ctx->mCullingBounds.Resize( count );
+		ctx->mCullingVisibility.resize( count );
+
+		// Default frustum contains everything
+		Frustum frustum = mFrustumCullingEnabled ? Frustum( camera->GetViewProjection( ) ) : Frustum( );
+
+		auto cull = [ & ]( const u32& begin, const u32& end )
+		{
+			// World bounds are cached per renderable, so each batch only touches its own renderables
+			for ( u32 i = begin; i < end; ++i )
+			{
+				Renderable* renderable = i < staticCount ? ( Renderable* )staticMeshRenderables[ i ] : ( Renderable* )skeletalMeshRenderables[ i - staticCount ];
+				ctx->mCullingBounds.Set( i, renderable->GetWorldBounds( ) );
+			}
+
+			frustum.CullBounds( ctx->mCullingBounds, begin, end, ctx->mCullingVisibility.data( ) );
+		};
+
+		JobSystem* jobSystem = EngineSubsystem( JobSystem );
+		if ( jobSystem && count > RENDERABLE_CULLING_BATCH_SIZE )
+		{
+			jobSystem->ParallelFor( count, RENDERABLE_CULLING_BATCH_SIZE, cull );
+		}
+		else
+		{
+			cull( 0, count );
+		}
+
+		// Compact in submission order so material sorting of the scene is kept
+		for ( u32 i = 0; i < count; ++i )
+		{
+			Renderable* renderable = i < staticCount ? ( Renderable* )staticMeshRenderables[ i ] : ( Renderable* )skeletalMeshRenderables[ i - staticCount ];
+
+			if ( !ctx->mCullingVisibility[ i ] )
+			{
+				// Keep previous model matrix current so motion blur is correct once the renderable comes back into view
+				renderable->Bind( );
+				renderable->Unbind( );
+			}
+			else if ( i < staticCount )
+			{
+				visibleSet.mStaticMeshRenderables.push_back( staticMeshRenderables[ i ] );
+			}
+			else
+			{
+				visibleSet.mSkeletalMeshRenderables.push_back( skeletalMeshRenderables[ i - staticCount ] );
+			}
+		}
+
+		visibleSet.mVisibleCount = ( u32 )( visibleSet.mStaticMeshRenderables.size( ) + visibleSet.mSkeletalMeshRenderables.size( ) );
+		visibleSet.mCulledCount = count - visibleSet.mVisibleCount;
+	}
+
+	//======================================================================================================
+
 	void GraphicsSubsystem::GBufferPass( GraphicsSubsystemContext* ctx )
 	{
 		static float wt = 0.0f;
@@ -874,124 +979,135 @@ namespace Enjon
 		// Grab graphics scene from context
 		GraphicsScene* scene = ctx->GetGraphicsScene( );
  
-		// Get sorted renderables by material
-		const Vector< StaticMeshRenderable* >& sortedStaticMeshRenderables = scene->GetStaticMeshRenderables();
-		const Vector< SkeletalMeshRenderable* >& sortedSkeletalMeshRenderables = scene->GetSkeletalMeshRenderables( );
+		Camera* camera = scene->GetActiveCamera( );
+
+		// Drop renderables outside of the camera frustum before any state is bound for them
+		CullRenderables( ctx, camera );
+
+		// Camera and time data for every shader graph shader in this pass
+		UpdateFrameUniforms( camera, ctx->mPreviousViewProjectionMatrix, wt );
+
+		const Vector< StaticMeshRenderable* >& sortedStaticMeshRenderables = ctx->mVisibleSet.mStaticMeshRenderables;
+		const Vector< SkeletalMeshRenderable* >& sortedSkeletalMeshRenderables = ctx->mVisibleSet.mSkeletalMeshRenderables;
 		const HashSet< QuadBatch* >& sortedQuadBatches = scene->GetQuadBatches(); 
 
-		Camera* camera = scene->GetActiveCamera( );
 		Mat4x4 viewMtx = camera->GetView( );
 		Mat4x4 projMtx = camera->GetProjection( );
 		Mat4x4 viewProjMtx = camera->GetViewProjection( );
 
-		if (!sortedStaticMeshRenderables.empty())
-		{ 
-			// Shader graph to be used
-			Enjon::AssetHandle< Enjon::ShaderGraph > sg; 
-			const Material* material = nullptr;
+		// One command per submesh of every visible renderable, sorted so shader, material and vertex array changes are
+		// minimized across all of them
+		RenderQueue& queue = ctx->mRenderQueue;
+		queue.Clear( );
 
-			for (auto& renderable : sortedStaticMeshRenderables)
-			{ 
-				renderable->Bind( );
-				{
-					// For each submesh
-					const Vector< SubMesh* >& subMeshes = renderable->GetMesh( )->GetSubmeshes( );
-					for ( u32 i = 0; i < subMeshes.size(); ++i )
-					{
-						const Material* curMaterial = renderable->GetMaterial( i ).Get( );
-						sg = curMaterial->GetShaderGraph( );
-						assert( curMaterial != nullptr );
+		Vec3 cameraPosition = camera->GetPosition( );
+		f32 invFar = 1.0f / camera->GetFar( );
 
-						if ( sg )
-						{
-							Enjon::Shader* sgShader = const_cast< Shader * >( sg->GetShader( ShaderPassType::Deferred_StaticGeom ) );
-							if ( material != curMaterial )
-							{
-								// Set material
-								material = curMaterial;
-
-								// Bind uniforms
-								sgShader->Use( );
-								sgShader->SetUniform( "uViewProjection", camera->GetViewProjection( ) );
-								sgShader->SetUniform( "uWorldTime", wt );
-								sgShader->SetUniform( "uViewPositionWorldSpace", camera->GetPosition( ) );
-								sgShader->SetUniform( "uPreviousViewProjection", ctx->mPreviousViewProjectionMatrix );
-								material->Bind( sgShader );
-							}
-
-							//sgShader->SetUniform( "uObjectID", Renderable::IdToColor( renderable->GetRenderableID( ) ) ); 
-							renderable->Submit( sg->GetShader( ShaderPassType::Deferred_StaticGeom ), subMeshes.at( i ), i );
-						}
-					} 
+		auto pushRenderable = [ & ]( Renderable* renderable, const ShaderPassType& pass )
+		{
+			// Model matrix is shared by all submeshes, so compute it once up front
+			renderable->Bind( );
+
+			const Bounds& bounds = renderable->GetWorldBounds( );
+			f32 depth = ( ( bounds.IsValid( ) ? bounds.GetCenter( ) : renderable->GetPosition( ) ) - cameraPosition ).Length( ) * invFar;
+
+			const Vector< SubMesh* >& subMeshes = renderable->GetMesh( )->GetSubmeshes( );
+			for ( u32 i = 0; i < subMeshes.size( ); ++i )
+			{
+				const Material* material = renderable->GetMaterial( i ).Get( );
+				assert( material != nullptr );
+
+				AssetHandle< ShaderGraph > sg = material->GetShaderGraph( );
+				if ( sg )
+				{
+					queue.Push( pass, sg->GetShader( pass ), material, subMeshes.at( i ), renderable, i, depth );
 				}
-				renderable->Unbind( );
 			}
+		};
+
+		for ( auto& renderable : sortedStaticMeshRenderables )
+		{
+			pushRenderable( renderable, ShaderPassType::Deferred_StaticGeom );
 		}
 
-		// Shader graph to be used
-		if (!sortedSkeletalMeshRenderables.empty())
-		{ 
-			AssetHandle< ShaderGraph > sg;
+		for ( auto& renderable : sortedSkeletalMeshRenderables )
+		{
+			pushRenderable( renderable, ShaderPassType::Deferred_Skinned_Geom );
+		}
+
+		queue.Sort( );
+
+		{
+			const Shader* shader = nullptr;
 			const Material* material = nullptr;
+			const SubMesh* subMesh = nullptr;
+			const Renderable* jointRenderable = nullptr;
 
-			for (auto& renderable : sortedSkeletalMeshRenderables)
-			{ 
-				renderable->Bind( );
+			for ( u32 c = 0; c < queue.GetCount( ); ++c )
+			{
+				const RenderCommand& command = queue.GetCommand( c );
+				Shader* sgShader = const_cast< Shader* >( command.mShader );
+
+				if ( shader != command.mShader )
+				{
+					shader = command.mShader;
+					material = nullptr;
+					jointRenderable = nullptr;
+
+					sgShader->Use( );
+				}
+
+				if ( material != command.mMaterial )
+				{
+					material = command.mMaterial;
+					material->Bind( sgShader );
+				}
+
+				Renderable* renderable = command.mRenderable;
+				if ( command.mPass == ShaderPassType::Deferred_Skinned_Geom && jointRenderable != renderable )
 				{
-					auto transforms = renderable->GetJointTransforms(); 
+					jointRenderable = renderable;
 
-					// For each submesh
-					const Vector< SubMesh* >& subMeshes = renderable->GetMesh( )->GetSubmeshes( );
-					for ( u32 i = 0; i < subMeshes.size(); ++i )
+					// Set transform uniforms in shader
+					UniformHandle jointTransforms = sgShader->GetUniformHandle( BuiltInUniform::JointTransforms );
+					const Vector< Mat4x4 >& transforms = static_cast< SkeletalMeshRenderable* >( renderable )->GetJointTransforms( );
+					for ( u32 i = 0; i < transforms.size( ); ++i )
 					{
-						const Material* curMaterial = renderable->GetMaterial( i ).Get( );
-						sg = curMaterial->GetShaderGraph( );
-						assert( curMaterial != nullptr ); 
-						if ( sg )
-						{
-							Enjon::Shader* sgShader = const_cast< Shader * >( sg->GetShader( ShaderPassType::Deferred_Skinned_Geom ) );
-							if ( material != curMaterial )
-							{
-								// Set material
-								material = curMaterial;
-
-								// Bind uniforms
-								sgShader->Use( );
-								sgShader->SetUniform( "uViewProjection", camera->GetViewProjection( ) );
-								sgShader->SetUniform( "uWorldTime", wt );
-								sgShader->SetUniform( "uViewPositionWorldSpace", camera->GetPosition( ) );
-								sgShader->SetUniform( "uPreviousViewProjection", ctx->mPreviousViewProjectionMatrix );
-								material->Bind( sgShader );
-							}
-
-							sgShader->SetUniform( "uObjectID", Renderable::IdToColor( renderable->GetRenderableID( ), i ) ); 
-
-							// Set transform uniforms in shader
-							for ( u32 i = 0; i < transforms.size(); ++i )
-							{
-								sgShader->SetUniformArrayElement( "uJointTransforms", i, transforms.at( i ) );
-							}
-
-							sgShader->SetUniform( "uModel", renderable->GetModelMatrix( ) );
-							sgShader->SetUniform( "uPreviousModel", renderable->GetPreviousModelMatrix( ) );
-
-							//renderable->Submit( sg->GetShader( ShaderPassType::Deferred_StaticGeom ), subMeshes.at( i ) );
-
-							// Bind submesh
-							subMeshes.at( i )->Bind( );
-							{
-								// Submit for rendering
-								subMeshes.at( i )->Submit( ); 
-							}
-							// Unbind submesh
-							subMeshes.at( i )->Unbind( ); 
-						}
-					} 
+						sgShader->SetUniformArrayElement( jointTransforms, i, transforms.at( i ) );
+					}
 				}
-				renderable->Unbind( );
+
+				sgShader->SetUniform( sgShader->GetUniformHandle( BuiltInUniform::Model ), renderable->GetModelMatrix( ) );
+				sgShader->SetUniform( sgShader->GetUniformHandle( BuiltInUniform::PreviousModel ), renderable->GetPreviousModelMatrix( ) );
+				sgShader->SetUniform( sgShader->GetUniformHandle( BuiltInUniform::ObjectID ), Renderable::IdToColor( renderable->GetRenderableID( ), command.mSubMeshIndex ) );
+
+				if ( subMesh != command.mSubMesh )
+				{
+					subMesh = command.mSubMesh;
+					subMesh->Bind( );
+				}
+
+				// Submit for rendering
+				subMesh->Submit( );
+			}
+
+			if ( subMesh )
+			{
+				subMesh->Unbind( );
 			}
 		}
 
+		// Current model matrices become previous ones only after every submesh has been drawn
+		for ( auto& renderable : sortedStaticMeshRenderables )
+		{
+			renderable->Unbind( );
+		}
+
+		for ( auto& renderable : sortedSkeletalMeshRenderables )
+		{
+			renderable->Unbind( );
+		}
+
 		// Quadbatches
 		Enjon::GLSLProgram* shader = Enjon::ShaderManager::Get("QuadBatch");
 		shader->Use();
@@ -1033,10 +1149,6 @@ namespace Enjon
 						}
 						
 						sgShader->Use( );
-						sgShader->SetUniform( "uViewProjection", camera->GetViewProjection( ) );
-						sgShader->SetUniform( "uWorldTime", wt );
-						sgShader->SetUniform( "uViewPositionWorldSpace", camera->GetPosition( ) );
-						sgShader->SetUniform( "uPreviousViewProjection", ctx->mPreviousViewProjectionMatrix );
 						material->Bind( sgShader ); 
 					}
 
@@ -1581,6 +1693,9 @@ namespace Enjon
 		// Render non depth tested renderables
 		glClear( GL_DEPTH_BUFFER_BIT );
 
+		// No previous frame for these, so they write zero velocity
+		UpdateFrameUniforms( camera, camera->GetViewProjection( ), Engine::GetInstance( )->GetWorldTime( ).mTotalTime );
+
 		// None depth tested renderables
 		if ( !nonDepthTestedRenderables.empty( ) )
 		{
@@ -1603,15 +1718,11 @@ namespace Enjon
 						material = curMaterial;
 
 						sgShader->Use( );
-						sgShader->SetUniform( "uViewProjection", camera->GetViewProjection( ) );
-						sgShader->SetUniform( "uWorldTime", Engine::GetInstance( )->GetWorldTime( ).mTotalTime );
-						sgShader->SetUniform( "uViewPositionWorldSpace", camera->GetPosition( ) );
-						sgShader->SetUniform( "uPreviousViewProjection", camera->GetViewProjection( ) );
 						material->Bind( sgShader );
 					}
 
 					// Render object
-					sgShader->SetUniform( "uObjectID", Renderable::IdToColor( renderable->GetRenderableID( ), 0 ) );
+					sgShader->SetUniform( sgShader->GetUniformHandle( BuiltInUniform::ObjectID ), Renderable::IdToColor( renderable->GetRenderableID( ), 0 ) );
 					renderable->Submit( sg->GetShader( ShaderPassType::Deferred_StaticGeom ) );
 				}
 			}
@@ -1661,15 +1772,11 @@ namespace Enjon
 							material = curMaterial;
 
 							sgShader->Use( );
-							sgShader->SetUniform( "uViewProjection", camera->GetViewProjection( ) );
-							sgShader->SetUniform( "uWorldTime", Engine::GetInstance( )->GetWorldTime( ).mTotalTime );
-							sgShader->SetUniform( "uViewPositionWorldSpace", camera->GetPosition( ) );
-							sgShader->SetUniform( "uPreviousViewProjection", camera->GetViewProjection( ) );
 							material->Bind( sgShader );
 						}
 
 						// Render object
-						sgShader->SetUniform( "uObjectID", Renderable::IdToColor( renderable->GetRenderableID( ), 0 ) );
+						sgShader->SetUniform( sgShader->GetUniformHandle( BuiltInUniform::ObjectID ), Renderable::IdToColor( renderable->GetRenderableID( ), 0 ) );
 						renderable->Submit( sg->GetShader( ShaderPassType::Deferred_StaticGeom ) );
 					}
 				}
@@ -1784,6 +1891,9 @@ namespace Enjon
 						auto vp = GetViewport( );
 						Enjon::PrintText( 10.0f, vp.y - 20.0f, 1.0f, std::to_string( frameTime ) + " ms", uiFont, mUIBatch ); 
 						Enjon::PrintText( 10.0f, vp.y - 40.0f, 1.0f, isStandalone ? "Standalone" : "Editor", uiFont, mUIBatch ); 
+
+						const RenderVisibleSet& visibleSet = ctx->GetVisibleSet( );
+						Enjon::PrintText( 10.0f, vp.y - 60.0f, 1.0f, std::to_string( visibleSet.mVisibleCount ) + " visible, " + std::to_string( visibleSet.mCulledCount ) + " culled", uiFont, mUIBatch ); 
 					}
 				}
 				mUIBatch.End( );
@@ -2163,6 +2273,22 @@ namespace Enjon
 		    ImGui::TreePop();
 	    }
 
+		if (ImGui::TreeNode("Culling"))
+		{
+			ImGui::Checkbox("Frustum Culling##culling", &mFrustumCullingEnabled );
+
+			// Totals over every world being rendered
+			u32 visibleCount = 0, culledCount = 0;
+			for ( auto& ctx : mContexts )
+			{
+				visibleCount += ctx->GetVisibleSet( ).mVisibleCount;
+				culledCount += ctx->GetVisibleSet( ).mCulledCount;
+			}
+			ImGui::Text( "Visible: %u", visibleCount );
+			ImGui::Text( "Culled: %u", culledCount );
+			ImGui::TreePop();
+		}
+
 	    if (ImGui::TreeNode("FrameBuffers"))
 	    {
 	    	ImFontAtlas* atlas = ImGui::GetIO().Fonts;
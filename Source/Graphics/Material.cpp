@@ -297,7 +297,7 @@ namespace Enjon
 		AssetManager* am = EngineSubsystem( AssetManager );
 
 		// Get shadergraph assets in asset manager
-		const HashMap< String, AssetRecordInfo >* shaderGraphs = am->GetAssets< ShaderGraph >( );
+		const HashMap< UUID, AssetRecordInfo >* shaderGraphs = am->GetAssets< ShaderGraph >( );
 
 		// List shadergraph
 		const MetaClass* cls = Object::GetClass< ShaderGraph >( );
@@ -152,6 +152,7 @@ namespace Enjon
 
 		// Clear all submesh data
 		mSubMeshes.clear( ); 
+		mBounds = Bounds( );
 
 		return Result::SUCCESS;
 	}
@@ -198,6 +199,13 @@ namespace Enjon
 
 	//=========================================================================
 
+	const Bounds& Mesh::GetBounds( ) const
+	{
+		return mBounds;
+	}
+
+	//=========================================================================
+
 	void Mesh::SetVertexDecl( const VertexDataDeclaration& decl )
 	{
 		mVertexDecl = decl;
@@ -355,6 +363,44 @@ namespace Enjon
 
 	//=========================================================================
 
+	const Bounds& SubMesh::GetBounds( ) const
+	{
+		return mBounds;
+	}
+
+	//=========================================================================
+
+	void SubMesh::CalculateBounds( )
+	{
+		mBounds = Bounds( );
+
+		if ( !mMesh )
+		{
+			return;
+		}
+
+		// Position is always the first attribute
+		const VertexDataDeclaration& vertDecl = mMesh->GetVertexDeclaration( );
+		usize stride = vertDecl.GetSizeInBytes( );
+		if ( !stride || vertDecl.mDecl.empty( ) || ( vertDecl.mDecl.at( 0 ) != VertexAttributeFormat::Float3 && vertDecl.mDecl.at( 0 ) != VertexAttributeFormat::Float4 ) )
+		{
+			return;
+		}
+
+		const u8* data = mVertexData.GetData( );
+		usize size = mVertexData.GetSize( );
+		for ( usize offset = 0; offset + 3 * sizeof( f32 ) <= size; offset += stride )
+		{
+			f32 position[ 3 ];
+			std::memcpy( position, data + offset, sizeof( position ) );
+			mBounds.Encapsulate( Vec3( position[ 0 ], position[ 1 ], position[ 2 ] ) );
+		}
+
+		mMesh->mBounds.Encapsulate( mBounds );
+	}
+
+	//=========================================================================
+
 	Result SubMesh::SerializeData( ByteBuffer* buffer ) const
 	{ 
 		// Write out size of data
@@ -404,6 +450,9 @@ struct struct_name {\
 		// Set draw count
 		mDrawCount = mVertexData.GetSize( ) / vertDecl.GetSizeInBytes( );
 
+		// Bounds for culling
+		CalculateBounds( );
+
 		// Create and upload mesh data
 		glGenBuffers( 1, &mVBO );
 		glBindBuffer( GL_ARRAY_BUFFER, mVBO );
@@ -0,0 +1,165 @@
+// @file RenderQueue.cpp
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#include "Graphics/RenderQueue.h"
+#include "Graphics/ShaderGraph.h"
+
+#include <assert.h>
+#include <algorithm>
+
+namespace Enjon
+{
+	// Field widths of the sort key, most significant first
+	INTERNAL const u32 gPassBits		= 4;
+	INTERNAL const u32 gShaderBits		= 12;
+	INTERNAL const u32 gMaterialBits	= 16;
+	INTERNAL const u32 gSubMeshBits		= 16;
+	INTERNAL const u32 gDepthBits		= 16;
+
+	INTERNAL const u32 gDepthShift		= 0;
+	INTERNAL const u32 gSubMeshShift	= gDepthShift + gDepthBits;
+	INTERNAL const u32 gMaterialShift	= gSubMeshShift + gSubMeshBits;
+	INTERNAL const u32 gShaderShift		= gMaterialShift + gMaterialBits;
+	INTERNAL const u32 gPassShift		= gShaderShift + gShaderBits;
+
+	// One byte of the key per radix pass
+	INTERNAL const u32 gRadixBits		= 8;
+	INTERNAL const u32 gRadixBuckets	= 1 << gRadixBits;
+	INTERNAL const u32 gRadixPasses		= 64 / gRadixBits;
+
+	//==============================================================================
+
+	void RenderQueue::Clear( )
+	{
+		mCommands.clear( );
+		mKeys.clear( );
+		mOrder.clear( );
+		mShaderSlots.clear( );
+		mMaterialSlots.clear( );
+		mSubMeshSlots.clear( );
+	}
+
+	//==============================================================================
+
+	u32 RenderQueue::GetSlot( HashMap< const void*, u32 >& slots, const void* object, const u32& bits )
+	{
+		auto query = slots.find( object );
+		if ( query == slots.end( ) )
+		{
+			query = slots.emplace( object, ( u32 )slots.size( ) ).first;
+		}
+
+		return std::min( query->second, ( 1u << bits ) - 1 );
+	}
+
+	//==============================================================================
+
+	void RenderQueue::Push( const ShaderPassType& pass, const Shader* shader, const Material* material, const SubMesh* subMesh, Renderable* renderable, const u32& subMeshIndex, const f32& depth )
+	{
+		assert( ( u32 )pass < ( 1u << gPassBits ) );
+
+		RenderCommand command;
+		command.mRenderable = renderable;
+		command.mShader = shader;
+		command.mMaterial = material;
+		command.mSubMesh = subMesh;
+		command.mSubMeshIndex = subMeshIndex;
+		command.mPass = pass;
+
+		// Front to back within equal state, so early depth testing rejects more of what's drawn later
+		f32 clampedDepth = std::max( 0.0f, std::min( depth, 1.0f ) );
+		u64 quantizedDepth = ( u64 )( clampedDepth * ( f32 )( ( 1u << gDepthBits ) - 1 ) );
+
+		RenderSortKey key = ( ( u64 )pass << gPassShift )
+							| ( ( u64 )GetSlot( mShaderSlots, shader, gShaderBits ) << gShaderShift )
+							| ( ( u64 )GetSlot( mMaterialSlots, material, gMaterialBits ) << gMaterialShift )
+							| ( ( u64 )GetSlot( mSubMeshSlots, subMesh, gSubMeshBits ) << gSubMeshShift )
+							| ( quantizedDepth << gDepthShift );
+
+		mOrder.push_back( ( u32 )mCommands.size( ) );
+		mCommands.push_back( command );
+		mKeys.push_back( key );
+	}
+
+	//==============================================================================
+
+	// Least significant digit first radix sort, moving keys along with command indices. Every pass is stable, so the
+	// final order is by full key with push order kept for ties. Digits where all keys agree are skipped, which is most
+	// of the upper ones since slots are dense.
+	void RenderQueue::Sort( )
+	{
+		u32 count = ( u32 )mKeys.size( );
+		if ( count < 2 )
+		{
+			return;
+		}
+
+		// Histograms of every digit in one sweep over the keys
+		u32 histograms[ gRadixPasses ][ gRadixBuckets ] = { };
+		for ( u32 i = 0; i < count; ++i )
+		{
+			RenderSortKey key = mKeys[ i ];
+			for ( u32 p = 0; p < gRadixPasses; ++p )
+			{
+				histograms[ p ][ ( key >> ( p * gRadixBits ) ) & ( gRadixBuckets - 1 ) ]++;
+			}
+		}
+
+		mScratchKeys.resize( count );
+		mScratchOrder.resize( count );
+
+		for ( u32 p = 0; p < gRadixPasses; ++p )
+		{
+			u32* histogram = histograms[ p ];
+			u32 shift = p * gRadixBits;
+
+			// Every key lands in one bucket, this digit can't change the order
+			if ( histogram[ ( mKeys[ 0 ] >> shift ) & ( gRadixBuckets - 1 ) ] == count )
+			{
+				continue;
+			}
+
+			// Bucket counts to starting offsets
+			u32 offset = 0;
+			for ( u32 b = 0; b < gRadixBuckets; ++b )
+			{
+				u32 bucketCount = histogram[ b ];
+				histogram[ b ] = offset;
+				offset += bucketCount;
+			}
+
+			for ( u32 i = 0; i < count; ++i )
+			{
+				u32 dst = histogram[ ( mKeys[ i ] >> shift ) & ( gRadixBuckets - 1 ) ]++;
+				mScratchKeys[ dst ] = mKeys[ i ];
+				mScratchOrder[ dst ] = mOrder[ i ];
+			}
+
+			mKeys.swap( mScratchKeys );
+			mOrder.swap( mScratchOrder );
+		}
+	}
+
+	//==============================================================================
+
+	u32 RenderQueue::GetCount( ) const
+	{
+		return ( u32 )mCommands.size( );
+	}
+
+	//==============================================================================
+
+	const RenderCommand& RenderQueue::GetCommand( const u32& index ) const
+	{
+		return mCommands.at( mOrder.at( index ) );
+	}
+
+	//==============================================================================
+
+	RenderSortKey RenderQueue::GetSortKey( const u32& index ) const
+	{
+		return mKeys.at( index );
+	}
+
+	//==============================================================================
+}
@@ -75,6 +75,7 @@ namespace Enjon
 	void Renderable::SetTransform(const Transform& transform) 
 	{ 
 		mTransform = transform; 
+		mWorldBoundsDirty = true;
 	}
 
 	//==============================================================
@@ -82,24 +83,28 @@ namespace Enjon
 	void Renderable::SetPosition(const Vec3& position)
 	{
 		mTransform.SetPosition(position);
+		mWorldBoundsDirty = true;
 	}
 
 	//--------------------------------------------------------------------
 	void Renderable::SetScale(const Vec3& scale)
 	{
 		mTransform.SetScale(scale);
+		mWorldBoundsDirty = true;
 	}
 
 	//--------------------------------------------------------------------
 	void Renderable::SetScale(const f32& scale)
 	{
 		mTransform.SetScale(scale);
+		mWorldBoundsDirty = true;
 	}
 
 	//--------------------------------------------------------------------
 	void Renderable::SetRotation(const Quaternion& rotation)
 	{
 		mTransform.SetRotation(rotation);
+		mWorldBoundsDirty = true;
 	}
 
 	//==============================================================
@@ -110,6 +115,7 @@ namespace Enjon
 		Quaternion Y = Quaternion::AngleAxis(Pitch, mTransform.GetRotation() * Vec3(1, 0, 0));	// Relative Right
 
 		mTransform.SetRotation( X * Y * mTransform.GetRotation( ) );
+		mWorldBoundsDirty = true;
 	}
 
 	//--------------------------------------------------------------------
@@ -159,6 +165,26 @@ namespace Enjon
 
 	//==============================================================================
 
+	const Bounds& Renderable::GetWorldBounds( )
+	{
+		const Mesh* mesh = GetMesh( );
+		if ( mWorldBoundsDirty || mesh != mWorldBoundsMesh )
+		{
+			mWorldBoundsMesh = mesh;
+			mWorldBounds = mesh ? mesh->GetBounds( ) : Bounds( );
+
+			if ( mWorldBounds.IsValid( ) )
+			{
+				mWorldBounds = mWorldBounds.TransformedBy( Mat4x4::Translate( GetPosition( ) ) * QuaternionToMat4x4( GetRotation( ) ) * Mat4x4::Scale( GetScale( ) ) );
+				mWorldBoundsDirty = false;
+			}
+		}
+
+		return mWorldBounds;
+	}
+
+	//==============================================================================
+
 	void Renderable::Submit( const Enjon::Shader* shader, const SubMesh* subMesh, const u32& subMeshIndex )
 	{
 		if ( shader == nullptr )
@@ -167,9 +193,9 @@ namespace Enjon
 		}
 
 		Shader* shdr = const_cast< Shader* >( shader );
-		shdr->SetUniform( "uModel", mCurrentModelMatrix );
-		shdr->SetUniform( "uPreviousModel", mPreviousModelMatrix );
-		shdr->SetUniform( "uObjectID", Renderable::IdToColor( GetRenderableID( ), subMeshIndex ) ); 
+		shdr->SetUniform( shdr->GetUniformHandle( BuiltInUniform::Model ), mCurrentModelMatrix );
+		shdr->SetUniform( shdr->GetUniformHandle( BuiltInUniform::PreviousModel ), mPreviousModelMatrix );
+		shdr->SetUniform( shdr->GetUniformHandle( BuiltInUniform::ObjectID ), Renderable::IdToColor( GetRenderableID( ), subMeshIndex ) ); 
 
 		// Bind submesh
 		subMesh->Bind( );
@@ -223,8 +249,8 @@ namespace Enjon
 				Model *= Mat4x4::Translate( GetPosition( ) );
 				Model *= QuaternionToMat4x4( GetRotation( ) );
 				Model *= Mat4x4::Scale( GetScale( ) );
-				const_cast< Enjon::Shader* > ( shader )->SetUniform( "uModel", Model );
-				const_cast< Enjon::Shader* > ( shader )->SetUniform( "uPreviousModel", mPreviousModelMatrix );
+				const_cast< Enjon::Shader* > ( shader )->SetUniform( shader->GetUniformHandle( BuiltInUniform::Model ), Model );
+				const_cast< Enjon::Shader* > ( shader )->SetUniform( shader->GetUniformHandle( BuiltInUniform::PreviousModel ), mPreviousModelMatrix );
 
 				// For each submesh, bind
 				for ( auto& sm : subMeshes )
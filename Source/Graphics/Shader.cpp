@@ -149,6 +149,10 @@ namespace Enjon
 
 		// Release all uniforms
 		mUniformMap.clear( );
+		for ( auto& handle : mBuiltInUniforms )
+		{
+			handle = -1;
+		}
 
 		return Enjon::Result::SUCCESS;
 	}
@@ -269,6 +273,19 @@ namespace Enjon
 			mUniformMap[Name] = (u32)Location;
 		}
 
+		// Frame data comes from one uniform buffer shared by every shader
+		GLuint frameBlockIndex = glGetUniformBlockIndex( mProgramID, FRAME_UNIFORM_BLOCK_NAME );
+		if ( frameBlockIndex != GL_INVALID_INDEX )
+		{
+			glUniformBlockBinding( mProgramID, frameBlockIndex, FRAME_UNIFORM_BLOCK_BINDING );
+		}
+
+		// Resolve per draw uniforms once rather than by name for every draw
+		mBuiltInUniforms[ ( u32 )BuiltInUniform::Model ] = GetUniformHandle( "uModel" );
+		mBuiltInUniforms[ ( u32 )BuiltInUniform::PreviousModel ] = GetUniformHandle( "uPreviousModel" );
+		mBuiltInUniforms[ ( u32 )BuiltInUniform::ObjectID ] = GetUniformHandle( "uObjectID" );
+		mBuiltInUniforms[ ( u32 )BuiltInUniform::JointTransforms ] = GetUniformHandle( "uJointTransforms" );
+
 		//Always detach shaders after a successful link
 		glDetachShader(mProgramID, mVertexShaderID);
 		glDetachShader(mProgramID, mFragmentShaderID);
@@ -410,6 +427,86 @@ namespace Enjon
 		}
 	}
 
+	UniformHandle Shader::GetUniformHandle( const Enjon::String& uniformName ) const
+	{
+		auto search = mUniformMap.find( uniformName );
+		if ( search == mUniformMap.end( ) )
+		{
+			search = mUniformMap.find( uniformName + "[0]" );
+		}
+
+		return search != mUniformMap.end( ) ? ( UniformHandle )search->second : -1;
+	}
+
+	UniformHandle Shader::GetUniformHandle( const BuiltInUniform& uniform ) const
+	{
+		return mBuiltInUniforms[ ( u32 )uniform ];
+	}
+
+	void Shader::SetUniform( const UniformHandle& handle, const s32& val )
+	{
+		if ( handle >= 0 )
+		{
+			glUniform1i( handle, val );
+		}
+	}
+
+	void Shader::SetUniform( const UniformHandle& handle, const f32& val )
+	{
+		if ( handle >= 0 )
+		{
+			glUniform1f( handle, val );
+		}
+	}
+
+	void Shader::SetUniform( const UniformHandle& handle, const Vec2& vector )
+	{
+		if ( handle >= 0 )
+		{
+			glUniform2f( handle, vector.x, vector.y );
+		}
+	}
+
+	void Shader::SetUniform( const UniformHandle& handle, const Vec3& vector )
+	{
+		if ( handle >= 0 )
+		{
+			glUniform3f( handle, vector.x, vector.y, vector.z );
+		}
+	}
+
+	void Shader::SetUniform( const UniformHandle& handle, const Vec4& vector )
+	{
+		if ( handle >= 0 )
+		{
+			glUniform4f( handle, vector.x, vector.y, vector.z, vector.w );
+		}
+	}
+
+	void Shader::SetUniform( const UniformHandle& handle, const Mat4x4& matrix )
+	{
+		if ( handle >= 0 )
+		{
+			glUniformMatrix4fv( handle, 1, GL_FALSE, matrix.elements );
+		}
+	}
+
+	void Shader::SetUniform( const UniformHandle& handle, const ColorRGBA32& color )
+	{
+		if ( handle >= 0 )
+		{
+			glUniform4f( handle, color.r, color.g, color.b, color.a );
+		}
+	}
+
+	void Shader::SetUniformArrayElement( const UniformHandle& handle, const u32& index, const Mat4x4& mat )
+	{
+		if ( handle >= 0 )
+		{
+			glUniformMatrix4fv( handle + index, 1, GL_FALSE, mat.elements );
+		}
+	}
+
 	void Shader::BindTexture(const std::string& name, const u32& TextureID, const u32 Index)
 	{
 		glEnable(GL_TEXTURE_2D);
@@ -60,6 +60,22 @@ namespace Enjon
 		return "\t" + line + "\n";
 	}
 
+	//=========================================================================================================================
+
+	// Must match FrameUniformBlock. Members of an unnamed block are referenced without a prefix, like plain uniforms.
+	Enjon::String OutputFrameUniformBlock( )
+	{
+		Enjon::String code = "";
+		code += OutputLine( "layout (std140) uniform " + Enjon::String( FRAME_UNIFORM_BLOCK_NAME ) );
+		code += OutputLine( "{" );
+		code += OutputTabbedLine( "mat4 uViewProjection;" );
+		code += OutputTabbedLine( "mat4 uPreviousViewProjection;" );
+		code += OutputTabbedLine( "vec3 uViewPositionWorldSpace;" );
+		code += OutputTabbedLine( "float uWorldTime;" );
+		code += OutputLine( "};" );
+		return code;
+	}
+
 	Enjon::String OutputErrorBlock( const Enjon::String& line )
 	{
 		Enjon::String code = "";
@@ -1084,10 +1100,7 @@ namespace Enjon
 
 		// Global uniforms
 		code += OutputLine( "// Gloabl Uniforms" );
-		code += OutputLine( "uniform float uWorldTime = 1.0f;" );
-		code += OutputLine( "uniform mat4 uViewProjection;" );
-		code += OutputLine( "uniform mat4 uPreviousViewProjection;" );
-		code += OutputLine( "uniform vec3 uViewPositionWorldSpace;" );
+		code += OutputFrameUniformBlock( );
 		code += OutputLine( "uniform mat4 uModel = mat4( 1.0f );" );
 		code += OutputLine( "uniform mat4 uPreviousModel = mat4( 1.0f );" );
 		code += OutputLine( "uniform vec4 uObjectID;" );
@@ -1603,10 +1616,7 @@ namespace Enjon
 
 		// Comment for declarations
 		code += OutputLine( "// Global Uniforms" );
-		code += OutputLine( "uniform float uWorldTime = 1.0f;" );
-		code += OutputLine( "uniform vec3 uViewPositionWorldSpace;" );
-		code += OutputLine( "uniform mat4 uPreviousViewProjection;" );
-		code += OutputLine( "uniform mat4 uViewProjection;" );
+		code += OutputFrameUniformBlock( );
 
 		// Comment for declarations
 		code += OutputLine( "\n// Variable Declarations" );
@@ -34,32 +34,54 @@ namespace Enjon
 		}
 
 		matrices.resize( mJoints.size( ) );
-		
-		CalculateTransform( mRootID, Mat4x4::Identity( ), matrices, animationHandle.Get(), time );
+
+		const SkeletalAnimation* animation = animationHandle.Get( );
+		if ( animation )
+		{
+			TransformStream jointTransforms;
+			Vector< Mat4x4 > jointMatrices;
+			CalculateJointMatrices( animation, time, jointTransforms, jointMatrices );
+			CalculateTransform( mRootID, Mat4x4::Identity( ), matrices, &jointMatrices );
+		}
+		else
+		{
+			CalculateTransform( mRootID, Mat4x4::Identity( ), matrices, nullptr );
+		}
 
 		return matrices;
 	}
 
 	//==================================================================== 
 
-	void Skeleton::CalculateTransform( const u32& jointID, const Mat4x4& parentMatrix, Vector<Mat4x4>& outMatrices, const SkeletalAnimation* animation, const f32& time ) const
+	void Skeleton::CalculateJointMatrices( const SkeletalAnimation* animation, const f32& time, TransformStream& jointTransforms, Vector< Mat4x4 >& outJointMatrices ) const
+	{
+		u32 jointCount = ( u32 )mJoints.size( );
+		jointTransforms.Resize( jointCount );
+		outJointMatrices.resize( jointCount );
+
+		for ( u32 i = 0; i < jointCount; ++i )
+		{
+			jointTransforms.Set( i, animation->CalculateInterpolatedTransform( time, i ) );
+		}
+
+		TransformStream::ToMatrices( jointTransforms, outJointMatrices.data( ), 0, jointCount );
+	}
+
+	//==================================================================== 
+
+	void Skeleton::CalculateTransform( const u32& jointID, const Mat4x4& parentMatrix, Vector<Mat4x4>& outMatrices, const Vector< Mat4x4 >* jointMatrices ) const
 	{
 		// Get joint
 		const Joint* joint = &mJoints.at( jointID );
 
-		// Calculate bone transform ( bone space ) // Identity for now ( No animation )
-		Mat4x4 jointTransform = Mat4x4::Identity( );
-		if ( animation )
-		{
-			Transform t =  animation->CalculateInterpolatedTransform( time, jointID );
-			jointTransform = t.ToMat4x4( );
-		} 
+		// Calculate bone transform ( bone space ), identity with no animation
+		Mat4x4 jointTransform = jointMatrices ? jointMatrices->at( jointID ) : Mat4x4::Identity( );
 
 		// Calculate relative to parent
 		Mat4x4 relativeTransform = parentMatrix * jointTransform;
 
 		// Calculate and set local space matrix
-		if ( animation != nullptr )
+		if ( jointMatrices != nullptr )
 		{
 			outMatrices.at( joint->mID ) = mGlobalInverseTransform * relativeTransform * joint->mInverseBindMatrix; 
 		}
@@ -71,7 +93,7 @@ namespace Enjon
 		// Iterate through children 
 		for ( u32 i = 0; i < joint->mChildren.size(); ++i )
 		{
-			CalculateTransform( joint->mChildren.at( i ), relativeTransform, outMatrices, animation, time );				
+			CalculateTransform( joint->mChildren.at( i ), relativeTransform, outMatrices, jointMatrices );				
 		}
 	} 
 
@@ -1181,6 +1181,18 @@ namespace Enjon
 			// Get property name
 			Enjon::String name = prop->GetName( ); 
 
+			// Instance reading value through to its archetype's component, only editable once overridden
+			if ( object->GetPropertySource( prop ) != object && object->Class( )->InstanceOf< Component >( ) )
+			{
+				ImGui::Text( fmt::format( "{}: Shared", name ).c_str( ) );
+				ImGui::SameLine( );
+				if ( ImGui::Button( fmt::format( "Override##{}{}", name, (u32)object ).c_str( ) ) )
+				{
+					object->ConstCast< Component >( )->DetachSharedSource( prop );
+				}
+				continue;
+			}
+
 			switch ( prop->GetType( ) )
 			{
 				// Primitive types
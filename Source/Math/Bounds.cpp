@@ -0,0 +1,143 @@
+// @file Bounds.cpp
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#include "Math/Bounds.h"
+#include "Defines.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Enjon
+{
+	// Extent stored for invalid bounds. Large enough to never be culled, small enough to stay finite when multiplied by
+	// a zero plane component.
+	INTERNAL const f32 gUnboundedExtent = 1e30f;
+
+	//==============================================================================
+
+	Bounds::Bounds( )
+		: mMin( std::numeric_limits< f32 >::max( ) ), mMax( -std::numeric_limits< f32 >::max( ) )
+	{
+	}
+
+	//==============================================================================
+
+	Bounds::Bounds( const Vec3& min, const Vec3& max )
+		: mMin( min ), mMax( max )
+	{
+	}
+
+	//==============================================================================
+
+	bool Bounds::IsValid( ) const
+	{
+		return mMin.x <= mMax.x && mMin.y <= mMax.y && mMin.z <= mMax.z;
+	}
+
+	//==============================================================================
+
+	void Bounds::Encapsulate( const Vec3& point )
+	{
+		mMin = Vec3( std::min( mMin.x, point.x ), std::min( mMin.y, point.y ), std::min( mMin.z, point.z ) );
+		mMax = Vec3( std::max( mMax.x, point.x ), std::max( mMax.y, point.y ), std::max( mMax.z, point.z ) );
+	}
+
+	//==============================================================================
+
+	void Bounds::Encapsulate( const Bounds& other )
+	{
+		if ( other.IsValid( ) )
+		{
+			Encapsulate( other.mMin );
+			Encapsulate( other.mMax );
+		}
+	}
+
+	//==============================================================================
+
+	Vec3 Bounds::GetMin( ) const
+	{
+		return mMin;
+	}
+
+	//==============================================================================
+
+	Vec3 Bounds::GetMax( ) const
+	{
+		return mMax;
+	}
+
+	//==============================================================================
+
+	Vec3 Bounds::GetCenter( ) const
+	{
+		return ( mMin + mMax ) * 0.5f;
+	}
+
+	//==============================================================================
+
+	Vec3 Bounds::GetExtents( ) const
+	{
+		return ( mMax - mMin ) * 0.5f;
+	}
+
+	//==============================================================================
+
+	// Center is transformed as a point, extents by the absolute value of the matrix ( Arvo )
+	Bounds Bounds::TransformedBy( const Mat4x4& matrix ) const
+	{
+		if ( !IsValid( ) )
+		{
+			return *this;
+		}
+
+		Vec3 center = matrix * GetCenter( );
+		Vec3 extents = GetExtents( );
+		const f32* m = matrix.elements;
+
+		Vec3 newExtents;
+		for ( u32 row = 0; row < 3; ++row )
+		{
+			( &newExtents.x )[ row ] = std::fabs( m[ 0 + row ] ) * extents.x + std::fabs( m[ 4 + row ] ) * extents.y + std::fabs( m[ 8 + row ] ) * extents.z;
+		}
+
+		return Bounds( center - newExtents, center + newExtents );
+	}
+
+	//==============================================================================
+
+	void BoundsStream::Resize( const u32& count )
+	{
+		mCenterX.resize( count, 0.0f );
+		mCenterY.resize( count, 0.0f );
+		mCenterZ.resize( count, 0.0f );
+		mExtentX.resize( count, gUnboundedExtent );
+		mExtentY.resize( count, gUnboundedExtent );
+		mExtentZ.resize( count, gUnboundedExtent );
+	}
+
+	//==============================================================================
+
+	u32 BoundsStream::GetCount( ) const
+	{
+		return ( u32 )mCenterX.size( );
+	}
+
+	//==============================================================================
+
+	void BoundsStream::Set( const u32& index, const Bounds& bounds )
+	{
+		Vec3 center = bounds.IsValid( ) ? bounds.GetCenter( ) : Vec3( 0.0f );
+		Vec3 extents = bounds.IsValid( ) ? bounds.GetExtents( ) : Vec3( gUnboundedExtent );
+
+		mCenterX[ index ] = center.x;
+		mCenterY[ index ] = center.y;
+		mCenterZ[ index ] = center.z;
+		mExtentX[ index ] = extents.x;
+		mExtentY[ index ] = extents.y;
+		mExtentZ[ index ] = extents.z;
+	}
+
+	//==============================================================================
+}
@@ -0,0 +1,128 @@
+// @file Frustum.cpp
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#include "Math/Frustum.h"
+#include "Math/Simd.h"
+
+#include <assert.h>
+#include <cmath>
+
+namespace Enjon
+{
+	//==============================================================================
+
+	Frustum::Frustum( )
+	{
+		// 0x + 0y + 0z + 1 >= 0 holds everywhere
+		for ( u32 i = 0; i < 24; ++i )
+		{
+			mPlanes[ i ] = i < 18 ? 0.0f : 1.0f;
+		}
+	}
+
+	//==============================================================================
+
+	// Gribb / Hartmann, planes are sums and differences of the fourth row with the first three
+	Frustum::Frustum( const Mat4x4& viewProjection )
+	{
+		const f32* m = viewProjection.elements;
+
+		for ( u32 c = 0; c < 4; ++c )
+		{
+			f32 row0 = m[ c * 4 + 0 ];
+			f32 row1 = m[ c * 4 + 1 ];
+			f32 row2 = m[ c * 4 + 2 ];
+			f32 row3 = m[ c * 4 + 3 ];
+
+			mPlanes[ c * 6 + 0 ] = row3 + row0;		// Left
+			mPlanes[ c * 6 + 1 ] = row3 - row0;		// Right
+			mPlanes[ c * 6 + 2 ] = row3 + row1;		// Bottom
+			mPlanes[ c * 6 + 3 ] = row3 - row1;		// Top
+			mPlanes[ c * 6 + 4 ] = row3 + row2;		// Near
+			mPlanes[ c * 6 + 5 ] = row3 - row2;		// Far
+		}
+	}
+
+	//==============================================================================
+
+	bool Frustum::Intersects( const Bounds& bounds ) const
+	{
+		BoundsStream stream;
+		stream.Resize( 1 );
+		stream.Set( 0, bounds );
+
+		u8 visible = 0;
+		CullBounds( stream, 0, 1, &visible );
+		return visible != 0;
+	}
+
+	//==============================================================================
+
+	// Box is outside once center distance plus projected extents is behind any plane. Planes aren't normalized, both
+	// sides of the test scale by the same length.
+	void Frustum::CullBounds( const BoundsStream& bounds, const u32& begin, const u32& end, u8* outVisible ) const
+	{
+		assert( end <= bounds.GetCount( ) );
+
+		const f32* cx = bounds.mCenterX.data( );
+		const f32* cy = bounds.mCenterY.data( );
+		const f32* cz = bounds.mCenterZ.data( );
+		const f32* ex = bounds.mExtentX.data( );
+		const f32* ey = bounds.mExtentY.data( );
+		const f32* ez = bounds.mExtentZ.data( );
+
+		u32 i = begin;
+
+#if ENJON_MATH_SSE
+		__m128 planeX[ 6 ], planeY[ 6 ], planeZ[ 6 ], planeW[ 6 ];
+		__m128 absPlaneX[ 6 ], absPlaneY[ 6 ], absPlaneZ[ 6 ];
+		for ( u32 p = 0; p < 6; ++p )
+		{
+			planeX[ p ] = _mm_set1_ps( mPlanes[ p ] );
+			planeY[ p ] = _mm_set1_ps( mPlanes[ p + 6 ] );
+			planeZ[ p ] = _mm_set1_ps( mPlanes[ p + 12 ] );
+			planeW[ p ] = _mm_set1_ps( mPlanes[ p + 18 ] );
+			absPlaneX[ p ] = _mm_set1_ps( std::fabs( mPlanes[ p ] ) );
+			absPlaneY[ p ] = _mm_set1_ps( std::fabs( mPlanes[ p + 6 ] ) );
+			absPlaneZ[ p ] = _mm_set1_ps( std::fabs( mPlanes[ p + 12 ] ) );
+		}
+
+		const __m128 zero = _mm_setzero_ps( );
+
+		for ( ; i + 4 <= end; i += 4 )
+		{
+			__m128 x = _mm_loadu_ps( cx + i ), y = _mm_loadu_ps( cy + i ), z = _mm_loadu_ps( cz + i );
+			__m128 rx = _mm_loadu_ps( ex + i ), ry = _mm_loadu_ps( ey + i ), rz = _mm_loadu_ps( ez + i );
+
+			__m128 inside = _mm_cmpeq_ps( zero, zero );
+			for ( u32 p = 0; p < 6; ++p )
+			{
+				__m128 distance = _mm_add_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( planeX[ p ], x ), _mm_mul_ps( planeY[ p ], y ) ), _mm_mul_ps( planeZ[ p ], z ) ), planeW[ p ] );
+				__m128 radius = _mm_add_ps( _mm_add_ps( _mm_mul_ps( absPlaneX[ p ], rx ), _mm_mul_ps( absPlaneY[ p ], ry ) ), _mm_mul_ps( absPlaneZ[ p ], rz ) );
+				inside = _mm_and_ps( inside, _mm_cmpge_ps( _mm_add_ps( distance, radius ), zero ) );
+			}
+
+			s32 mask = _mm_movemask_ps( inside );
+			outVisible[ i + 0 ] = ( u8 )( ( mask >> 0 ) & 1 );
+			outVisible[ i + 1 ] = ( u8 )( ( mask >> 1 ) & 1 );
+			outVisible[ i + 2 ] = ( u8 )( ( mask >> 2 ) & 1 );
+			outVisible[ i + 3 ] = ( u8 )( ( mask >> 3 ) & 1 );
+		}
+#endif
+
+		for ( ; i < end; ++i )
+		{
+			bool inside = true;
+			for ( u32 p = 0; p < 6 && inside; ++p )
+			{
+				f32 distance = mPlanes[ p ] * cx[ i ] + mPlanes[ p + 6 ] * cy[ i ] + mPlanes[ p + 12 ] * cz[ i ] + mPlanes[ p + 18 ];
+				f32 radius = std::fabs( mPlanes[ p ] ) * ex[ i ] + std::fabs( mPlanes[ p + 6 ] ) * ey[ i ] + std::fabs( mPlanes[ p + 12 ] ) * ez[ i ];
+				inside = distance + radius >= 0.0f;
+			}
+
+			outVisible[ i ] = inside ? 1 : 0;
+		}
+	}
+
+	//==============================================================================
+}
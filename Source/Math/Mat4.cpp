@@ -1,4 +1,5 @@
 #include "Math/Mat4.h"
+#include "Math/Simd.h"
 
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/matrix.hpp>
@@ -37,41 +38,22 @@ namespace Enjon
 		
 	Mat4x4& Mat4x4::Multiply(const Mat4x4& other)
 	{ 
-		f32 data[16];
-		for (int y = 0; y < 4; y++)
-		{
-			for (int x = 0; x < 4; x++)
-			{
-				f32 sum = 0.0f;
-				for (int e = 0; e < 4; e++)
-				{
-					sum += elements[x + e * 4] * other.elements[e + y * 4];
-				}
-				data[x + y * 4] = sum;
-			}
-		}
-		memcpy(elements, data, 4 * 4 * sizeof(f32));
-
+		Simd::Active::Mat4Multiply( elements, other.elements, elements );
 		return *this;
 	}
 	
 	Vec3 Mat4x4::Multiply(const Vec3& other) const
 	{
-		return Vec3(
-			columns[0].x * other.x + columns[1].x * other.y + columns[2].x * other.z + columns[3].x,
-			columns[0].y * other.x + columns[1].y * other.y + columns[2].y * other.z + columns[3].y,
-			columns[0].z * other.x + columns[1].z * other.y + columns[2].z * other.z + columns[3].z
-		);
+		Vec3 result;
+		Simd::Active::Mat4MultiplyPoint( elements, &other.x, &result.x );
+		return result;
 	}
 	
 	Vec4 Mat4x4::Multiply(const Vec4& other) const
 	{
-		return Vec4(
-			columns[0].x * other.x + columns[1].x * other.y + columns[2].x * other.z + columns[3].x * other.w,
-			columns[0].y * other.x + columns[1].y * other.y + columns[2].y * other.z + columns[3].y * other.w,
-			columns[0].z * other.x + columns[1].z * other.y + columns[2].z * other.z + columns[3].z * other.w,
-			columns[0].w * other.x + columns[1].w * other.y + columns[2].w * other.z + columns[3].w * other.w
-		);
+		Vec4 result;
+		Simd::Active::Mat4MultiplyVec4( elements, other.data, result.data );
+		return result;
 	}
 
 	Mat4x4 operator*(Mat4x4 left, const Mat4x4& right)
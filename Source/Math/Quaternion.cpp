@@ -2,6 +2,7 @@
 // File: Quaternion.cpp
 
 #include <Math/Quaternion.h>
+#include <Math/Simd.h>
 
 #include <glm/glm.hpp>
 
@@ -14,19 +15,13 @@ namespace Enjon
 
 	f32 Quaternion::Length()
 	{
-		return sqrt(x*x + y*y + z*z + w*w);
+		return sqrt( Simd::Active::Dot4( &x, &x ) );
 	}
 	
 	Quaternion Quaternion::Normalize()
 	{
-		Quaternion Q = *this;
-		auto L = this->Length();
-
-		Q.x /= L;
-		Q.y /= L;
-		Q.z /= L;
-		Q.w /= L;
-
+		Quaternion Q;
+		Simd::Active::Normalize4( &x, &Q.x );
 		return Q;
 	}
 
@@ -44,36 +39,21 @@ namespace Enjon
 	Quaternion Quaternion::operator+(const Quaternion& Other) const
 	{
 		Quaternion C;
-
-		C.x = x + Other.x;
-		C.y = y + Other.y;
-		C.z = z + Other.z;
-		C.w = w + Other.w;
-
+		Simd::Active::Add4( &x, &Other.x, &C.x );
 		return C;
 	}
 
 	Quaternion Quaternion::operator-(const Quaternion& Other) const
 	{
 		Quaternion C;
-
-		C.x = x - Other.x;
-		C.y = y - Other.y;
-		C.z = z - Other.z;
-		C.w = w - Other.w;
-
+		Simd::Active::Subtract4( &x, &Other.x, &C.x );
 		return C;
 	}
 
 	Quaternion Quaternion::operator*(const Quaternion& Other) const 
 	{
 		Quaternion Result; 
-
-		Result.x = w * Other.x + Other.w * x + y * Other.z - Other.y * z;
-		Result.y = w * Other.y + Other.w * y + z * Other.x - Other.z * x;
-		Result.z = w * Other.z + Other.w * z + x * Other.y - Other.x * y;
-		Result.w = w * Other.w - x * Other.x - y * Other.y - z * Other.z; 
-
+		Simd::Active::QuatMultiply( &x, &Other.x, &Result.x );
 		return Result;	
 	}
 
@@ -125,21 +105,14 @@ namespace Enjon
 	Vec3 Quaternion::Rotate( const Vec3& v ) const
 	{
 		// nVidia SDK implementation
-
-		Vec3 uv;
-		Vec3 uuv;
-		Vec3 qVec( this->x, this->y, this->z );
-		uv = qVec.Cross( v );
-		uuv = qVec.Cross( uv );
-		uv *= ( 2.0f * w );
-		uuv *= 2.0f;
-
-		return v + uv + uuv;
+		Vec3 result;
+		Simd::Active::QuatRotate( &x, &v.x, &result.x );
+		return result;
 	}
 
 	f32 Quaternion::Dot( const Quaternion& other ) const
 	{ 
-		return ( this->x * other.x + this->y * other.y + this->z * other.z + this->w * other.w );
+		return Simd::Active::Dot4( &x, &other.x );
 	}
 
 	// Returns cross product with another quaternion
@@ -254,11 +227,7 @@ namespace Enjon
 		}
 
 		Quaternion q;
-		q.x = sclp * a.x + sclq * end.x;
-		q.y = sclp * a.y + sclq * end.y;
-		q.z = sclp * a.z + sclq * end.z;
-		q.w = sclp * a.w + sclq * end.w;
-
+		Simd::Active::Blend4( &a.x, sclp, &end.x, sclq, &q.x );
 		return q;
 	}
 			
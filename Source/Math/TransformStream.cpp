@@ -0,0 +1,490 @@
+// Copyright 2016-2017 John Jackson. All Rights Reserved.
+// File: TransformStream.cpp
+
+#include <Math/TransformStream.h>
+#include <Math/Simd.h>
+
+#include <assert.h>
+#include <cmath>
+
+/*
+* Every kernel is written once as a template over its lane type. f32 handles one transform at a time ( and the tail
+* of a range ), Lanes4 handles four neighbouring transforms with one SSE register per channel.
+*/
+
+namespace Enjon
+{
+	//==========================================================================
+
+	INTERNAL inline f32 Sqrt( const f32& v )
+	{
+		return std::sqrt( v );
+	}
+
+	template < typename T >
+	INTERNAL inline T LoadLane( const f32* v )
+	{
+		return *v;
+	}
+
+	INTERNAL inline void StoreLane( f32* out, const f32& v )
+	{
+		*out = v;
+	}
+
+	template < typename T >
+	INTERNAL inline T SetLane( const f32& v )
+	{
+		return v;
+	}
+
+	INTERNAL inline void LoadPoints( const Vec3* points, f32* out )
+	{
+		out[ 0 ] = points->x;
+		out[ 1 ] = points->y;
+		out[ 2 ] = points->z;
+	}
+
+	INTERNAL inline void StorePoints( const f32* v, Vec3* out )
+	{
+		out->x = v[ 0 ];
+		out->y = v[ 1 ];
+		out->z = v[ 2 ];
+	}
+
+	INTERNAL inline void StoreMatrices( const f32* m, Mat4x4* out )
+	{
+		for ( u32 i = 0; i < 16; ++i )
+		{
+			out->elements[ i ] = m[ i ];
+		}
+	}
+
+	//==========================================================================
+
+#if ENJON_MATH_SSE
+
+	struct Lanes4
+	{
+		__m128 v;
+	};
+
+	INTERNAL inline Lanes4 operator+( const Lanes4& a, const Lanes4& b ) { return { _mm_add_ps( a.v, b.v ) }; }
+	INTERNAL inline Lanes4 operator-( const Lanes4& a, const Lanes4& b ) { return { _mm_sub_ps( a.v, b.v ) }; }
+	INTERNAL inline Lanes4 operator*( const Lanes4& a, const Lanes4& b ) { return { _mm_mul_ps( a.v, b.v ) }; }
+	INTERNAL inline Lanes4 operator/( const Lanes4& a, const Lanes4& b ) { return { _mm_div_ps( a.v, b.v ) }; }
+	INTERNAL inline Lanes4 operator-( const Lanes4& a ) { return { _mm_xor_ps( a.v, _mm_set1_ps( -0.0f ) ) }; }
+	INTERNAL inline Lanes4 operator*( const f32& a, const Lanes4& b ) { return { _mm_mul_ps( _mm_set1_ps( a ), b.v ) }; }
+	INTERNAL inline Lanes4 operator-( const f32& a, const Lanes4& b ) { return { _mm_sub_ps( _mm_set1_ps( a ), b.v ) }; }
+
+	INTERNAL inline Lanes4 Sqrt( const Lanes4& v )
+	{
+		return { _mm_sqrt_ps( v.v ) };
+	}
+
+	template <>
+	inline Lanes4 LoadLane< Lanes4 >( const f32* v )
+	{
+		return { _mm_loadu_ps( v ) };
+	}
+
+	INTERNAL inline void StoreLane( f32* out, const Lanes4& v )
+	{
+		_mm_storeu_ps( out, v.v );
+	}
+
+	template <>
+	inline Lanes4 SetLane< Lanes4 >( const f32& v )
+	{
+		return { _mm_set1_ps( v ) };
+	}
+
+	// Gathers x, y and z of four neighbouring points into one register each
+	INTERNAL inline void LoadPoints( const Vec3* points, Lanes4* out )
+	{
+		out[ 0 ].v = _mm_setr_ps( points[ 0 ].x, points[ 1 ].x, points[ 2 ].x, points[ 3 ].x );
+		out[ 1 ].v = _mm_setr_ps( points[ 0 ].y, points[ 1 ].y, points[ 2 ].y, points[ 3 ].y );
+		out[ 2 ].v = _mm_setr_ps( points[ 0 ].z, points[ 1 ].z, points[ 2 ].z, points[ 3 ].z );
+	}
+
+	INTERNAL inline void StorePoints( const Lanes4* v, Vec3* out )
+	{
+		f32 r[ 3 ][ 4 ];
+		for ( u32 c = 0; c < 3; ++c )
+		{
+			_mm_storeu_ps( r[ c ], v[ c ].v );
+		}
+
+		for ( u32 i = 0; i < 4; ++i )
+		{
+			out[ i ] = Vec3( r[ 0 ][ i ], r[ 1 ][ i ], r[ 2 ][ i ] );
+		}
+	}
+
+	// Element k of four matrices is in m[ k ], transposed one column at a time into the four matrices
+	INTERNAL inline void StoreMatrices( const Lanes4* m, Mat4x4* out )
+	{
+		for ( u32 c = 0; c < 4; ++c )
+		{
+			__m128 r0 = m[ c * 4 + 0 ].v;
+			__m128 r1 = m[ c * 4 + 1 ].v;
+			__m128 r2 = m[ c * 4 + 2 ].v;
+			__m128 r3 = m[ c * 4 + 3 ].v;
+			_MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+
+			_mm_storeu_ps( out[ 0 ].elements + c * 4, r0 );
+			_mm_storeu_ps( out[ 1 ].elements + c * 4, r1 );
+			_mm_storeu_ps( out[ 2 ].elements + c * 4, r2 );
+			_mm_storeu_ps( out[ 3 ].elements + c * 4, r3 );
+		}
+	}
+
+#endif
+
+	//==========================================================================
+
+	template < typename T >
+	struct TransformLanes
+	{
+		T mPosition[ 3 ];
+		T mRotation[ 4 ];
+		T mScale[ 3 ];
+	};
+
+	template < typename T >
+	INTERNAL inline TransformLanes< T > LoadTransforms( const TransformStream& stream, const u32& index )
+	{
+		TransformLanes< T > t;
+		for ( u32 i = 0; i < 3; ++i ) t.mPosition[ i ] = LoadLane< T >( stream.GetChannel( ( TransformChannel )( ( u32 )TransformChannel::PositionX + i ) ) + index );
+		for ( u32 i = 0; i < 4; ++i ) t.mRotation[ i ] = LoadLane< T >( stream.GetChannel( ( TransformChannel )( ( u32 )TransformChannel::RotationX + i ) ) + index );
+		for ( u32 i = 0; i < 3; ++i ) t.mScale[ i ] = LoadLane< T >( stream.GetChannel( ( TransformChannel )( ( u32 )TransformChannel::ScaleX + i ) ) + index );
+		return t;
+	}
+
+	template < typename T >
+	INTERNAL inline void StoreTransforms( const TransformLanes< T >& t, TransformStream& stream, const u32& index )
+	{
+		for ( u32 i = 0; i < 3; ++i ) StoreLane( stream.GetChannel( ( TransformChannel )( ( u32 )TransformChannel::PositionX + i ) ) + index, t.mPosition[ i ] );
+		for ( u32 i = 0; i < 4; ++i ) StoreLane( stream.GetChannel( ( TransformChannel )( ( u32 )TransformChannel::RotationX + i ) ) + index, t.mRotation[ i ] );
+		for ( u32 i = 0; i < 3; ++i ) StoreLane( stream.GetChannel( ( TransformChannel )( ( u32 )TransformChannel::ScaleX + i ) ) + index, t.mScale[ i ] );
+	}
+
+	//==========================================================================
+
+	// Same evaluation order as Simd::Scalar::Normalize4
+	template < typename T >
+	INTERNAL inline void NormalizeQuat( const T* q, T* out )
+	{
+		T length = Sqrt( q[ 0 ] * q[ 0 ] + q[ 1 ] * q[ 1 ] + q[ 2 ] * q[ 2 ] + q[ 3 ] * q[ 3 ] );
+		for ( u32 i = 0; i < 4; ++i ) out[ i ] = q[ i ] / length;
+	}
+
+	// Same evaluation order as Simd::Scalar::QuatMultiply
+	template < typename T >
+	INTERNAL inline void QuatMultiply( const T* a, const T* b, T* out )
+	{
+		out[ 0 ] = a[ 3 ] * b[ 0 ] + a[ 0 ] * b[ 3 ] + a[ 1 ] * b[ 2 ] - a[ 2 ] * b[ 1 ];
+		out[ 1 ] = a[ 3 ] * b[ 1 ] + a[ 1 ] * b[ 3 ] + a[ 2 ] * b[ 0 ] - a[ 0 ] * b[ 2 ];
+		out[ 2 ] = a[ 3 ] * b[ 2 ] + a[ 2 ] * b[ 3 ] + a[ 0 ] * b[ 1 ] - a[ 1 ] * b[ 0 ];
+		out[ 3 ] = a[ 3 ] * b[ 3 ] - a[ 0 ] * b[ 0 ] - a[ 1 ] * b[ 1 ] - a[ 2 ] * b[ 2 ];
+	}
+
+	// Same evaluation order as Simd::Scalar::QuatRotate
+	template < typename T >
+	INTERNAL inline void QuatRotate( const T* q, const T* v, T* out )
+	{
+		T uv[ 3 ] =
+		{
+			q[ 1 ] * v[ 2 ] - q[ 2 ] * v[ 1 ],
+			q[ 2 ] * v[ 0 ] - q[ 0 ] * v[ 2 ],
+			q[ 0 ] * v[ 1 ] - q[ 1 ] * v[ 0 ]
+		};
+		T uuv[ 3 ] =
+		{
+			q[ 1 ] * uv[ 2 ] - q[ 2 ] * uv[ 1 ],
+			q[ 2 ] * uv[ 0 ] - q[ 0 ] * uv[ 2 ],
+			q[ 0 ] * uv[ 1 ] - q[ 1 ] * uv[ 0 ]
+		};
+
+		T w2 = 2.0f * q[ 3 ];
+		for ( u32 i = 0; i < 3; ++i )
+		{
+			out[ i ] = v[ i ] + uv[ i ] * w2 + 2.0f * uuv[ i ];
+		}
+	}
+
+	//==========================================================================
+
+	// Transform::operator*
+	template < typename T >
+	INTERNAL inline TransformLanes< T > ComposeLanes( const TransformLanes< T >& local, const TransformLanes< T >& parent )
+	{
+		TransformLanes< T > out;
+
+		T parentRotNorm[ 4 ], rotNorm[ 4 ], rot[ 4 ];
+		NormalizeQuat( parent.mRotation, parentRotNorm );
+		NormalizeQuat( local.mRotation, rotNorm );
+		QuatMultiply( parentRotNorm, rotNorm, rot );
+		NormalizeQuat( rot, out.mRotation );
+
+		T scaledPos[ 3 ], rotatedPos[ 3 ];
+		for ( u32 i = 0; i < 3; ++i ) scaledPos[ i ] = parent.mScale[ i ] * local.mPosition[ i ];
+		QuatRotate( parentRotNorm, scaledPos, rotatedPos );
+
+		for ( u32 i = 0; i < 3; ++i )
+		{
+			out.mPosition[ i ] = parent.mPosition[ i ] + rotatedPos[ i ];
+			out.mScale[ i ] = parent.mScale[ i ] * local.mScale[ i ];
+		}
+
+		return out;
+	}
+
+	//==========================================================================
+
+	// Transform::operator/
+	template < typename T >
+	INTERNAL inline TransformLanes< T > InverseComposeLanes( const TransformLanes< T >& world, const TransformLanes< T >& parent )
+	{
+		TransformLanes< T > out;
+
+		// Quaternion::Inverse( ), conjugate over squared length
+		const T* p = parent.mRotation;
+		T lengthSq = p[ 0 ] * p[ 0 ] + p[ 1 ] * p[ 1 ] + p[ 2 ] * p[ 2 ] + p[ 3 ] * p[ 3 ];
+		T parentInverse[ 4 ] = { -p[ 0 ] / lengthSq, -p[ 1 ] / lengthSq, -p[ 2 ] / lengthSq, p[ 3 ] / lengthSq };
+		NormalizeQuat( parentInverse, parentInverse );
+
+		T rotNorm[ 4 ], rot[ 4 ];
+		NormalizeQuat( world.mRotation, rotNorm );
+		QuatMultiply( parentInverse, rotNorm, rot );
+		NormalizeQuat( rot, out.mRotation );
+
+		T offset[ 3 ], rotatedOffset[ 3 ];
+		for ( u32 i = 0; i < 3; ++i ) offset[ i ] = world.mPosition[ i ] - parent.mPosition[ i ];
+		QuatRotate( parentInverse, offset, rotatedOffset );
+
+		for ( u32 i = 0; i < 3; ++i )
+		{
+			out.mPosition[ i ] = rotatedOffset[ i ] / parent.mScale[ i ];
+			out.mScale[ i ] = world.mScale[ i ] / parent.mScale[ i ];
+		}
+
+		return out;
+	}
+
+	//==========================================================================
+
+	// Transform::ToMat4x4( ), translate * rotate * scale written out directly. m is column major.
+	template < typename T >
+	INTERNAL inline void ToMatrixLanes( const TransformLanes< T >& t, T* m )
+	{
+		T q[ 4 ];
+		NormalizeQuat( t.mRotation, q );
+
+		T xx = q[ 0 ] * q[ 0 ], yy = q[ 1 ] * q[ 1 ], zz = q[ 2 ] * q[ 2 ];
+		T xy = q[ 0 ] * q[ 1 ], xz = q[ 0 ] * q[ 2 ], yz = q[ 1 ] * q[ 2 ];
+		T wx = q[ 3 ] * q[ 0 ], wy = q[ 3 ] * q[ 1 ], wz = q[ 3 ] * q[ 2 ];
+
+		T zero = SetLane< T >( 0.0f );
+
+		m[ 0 ] = ( 1.0f - 2.0f * ( yy + zz ) ) * t.mScale[ 0 ];
+		m[ 1 ] = ( 2.0f * ( xy + wz ) ) * t.mScale[ 0 ];
+		m[ 2 ] = ( 2.0f * ( xz - wy ) ) * t.mScale[ 0 ];
+		m[ 3 ] = zero;
+
+		m[ 4 ] = ( 2.0f * ( xy - wz ) ) * t.mScale[ 1 ];
+		m[ 5 ] = ( 1.0f - 2.0f * ( xx + zz ) ) * t.mScale[ 1 ];
+		m[ 6 ] = ( 2.0f * ( yz + wx ) ) * t.mScale[ 1 ];
+		m[ 7 ] = zero;
+
+		m[ 8 ] = ( 2.0f * ( xz + wy ) ) * t.mScale[ 2 ];
+		m[ 9 ] = ( 2.0f * ( yz - wx ) ) * t.mScale[ 2 ];
+		m[ 10 ] = ( 1.0f - 2.0f * ( xx + yy ) ) * t.mScale[ 2 ];
+		m[ 11 ] = zero;
+
+		m[ 12 ] = t.mPosition[ 0 ];
+		m[ 13 ] = t.mPosition[ 1 ];
+		m[ 14 ] = t.mPosition[ 2 ];
+		m[ 15 ] = SetLane< T >( 1.0f );
+	}
+
+	//==========================================================================
+
+	// Translate * rotate * scale applied to a point
+	template < typename T >
+	INTERNAL inline void TransformPointLanes( const TransformLanes< T >& t, const T* point, T* out )
+	{
+		T q[ 4 ], scaled[ 3 ], rotated[ 3 ];
+		NormalizeQuat( t.mRotation, q );
+
+		for ( u32 i = 0; i < 3; ++i ) scaled[ i ] = t.mScale[ i ] * point[ i ];
+		QuatRotate( q, scaled, rotated );
+		for ( u32 i = 0; i < 3; ++i ) out[ i ] = t.mPosition[ i ] + rotated[ i ];
+	}
+
+	//==========================================================================
+
+	template < typename T >
+	INTERNAL inline void ComposeAt( const TransformStream& local, const TransformStream& parent, TransformStream& out, const u32& index )
+	{
+		StoreTransforms( ComposeLanes( LoadTransforms< T >( local, index ), LoadTransforms< T >( parent, index ) ), out, index );
+	}
+
+	template < typename T >
+	INTERNAL inline void InverseComposeAt( const TransformStream& world, const TransformStream& parent, TransformStream& out, const u32& index )
+	{
+		StoreTransforms( InverseComposeLanes( LoadTransforms< T >( world, index ), LoadTransforms< T >( parent, index ) ), out, index );
+	}
+
+	template < typename T >
+	INTERNAL inline void ToMatricesAt( const TransformStream& stream, Mat4x4* out, const u32& index )
+	{
+		T m[ 16 ];
+		ToMatrixLanes( LoadTransforms< T >( stream, index ), m );
+		StoreMatrices( m, out + index );
+	}
+
+	template < typename T >
+	INTERNAL inline void TransformPointsAt( const TransformStream& stream, const Vec3* points, Vec3* out, const u32& index )
+	{
+		T point[ 3 ], result[ 3 ];
+		LoadPoints( points + index, point );
+		TransformPointLanes( LoadTransforms< T >( stream, index ), point, result );
+		StorePoints( result, out + index );
+	}
+
+	//==========================================================================
+
+	TransformStream::TransformStream( const u32& count )
+	{
+		Resize( count );
+	}
+
+	//==========================================================================
+
+	void TransformStream::Resize( const u32& count )
+	{
+		for ( u32 c = 0; c < ( u32 )TransformChannel::Count; ++c )
+		{
+			TransformChannel channel = ( TransformChannel )c;
+			bool one = channel == TransformChannel::RotationW || channel == TransformChannel::ScaleX || channel == TransformChannel::ScaleY || channel == TransformChannel::ScaleZ;
+			mChannels[ c ].resize( count, one ? 1.0f : 0.0f );
+		}
+	}
+
+	//==========================================================================
+
+	void TransformStream::Clear( )
+	{
+		for ( auto& c : mChannels )
+		{
+			c.clear( );
+		}
+	}
+
+	//==========================================================================
+
+	u32 TransformStream::GetCount( ) const
+	{
+		return ( u32 )mChannels[ 0 ].size( );
+	}
+
+	//==========================================================================
+
+	void TransformStream::Set( const u32& index, const Transform& transform )
+	{
+		Vec3 position = transform.GetPosition( );
+		Quaternion rotation = transform.GetRotation( );
+		Vec3 scale = transform.GetScale( );
+
+		mChannels[ ( u32 )TransformChannel::PositionX ][ index ] = position.x;
+		mChannels[ ( u32 )TransformChannel::PositionY ][ index ] = position.y;
+		mChannels[ ( u32 )TransformChannel::PositionZ ][ index ] = position.z;
+		mChannels[ ( u32 )TransformChannel::RotationX ][ index ] = rotation.x;
+		mChannels[ ( u32 )TransformChannel::RotationY ][ index ] = rotation.y;
+		mChannels[ ( u32 )TransformChannel::RotationZ ][ index ] = rotation.z;
+		mChannels[ ( u32 )TransformChannel::RotationW ][ index ] = rotation.w;
+		mChannels[ ( u32 )TransformChannel::ScaleX ][ index ] = scale.x;
+		mChannels[ ( u32 )TransformChannel::ScaleY ][ index ] = scale.y;
+		mChannels[ ( u32 )TransformChannel::ScaleZ ][ index ] = scale.z;
+	}
+
+	//==========================================================================
+
+	Transform TransformStream::Get( const u32& index ) const
+	{
+		Vec3 position( mChannels[ ( u32 )TransformChannel::PositionX ][ index ], mChannels[ ( u32 )TransformChannel::PositionY ][ index ], mChannels[ ( u32 )TransformChannel::PositionZ ][ index ] );
+		Quaternion rotation( mChannels[ ( u32 )TransformChannel::RotationX ][ index ], mChannels[ ( u32 )TransformChannel::RotationY ][ index ], mChannels[ ( u32 )TransformChannel::RotationZ ][ index ], mChannels[ ( u32 )TransformChannel::RotationW ][ index ] );
+		Vec3 scale( mChannels[ ( u32 )TransformChannel::ScaleX ][ index ], mChannels[ ( u32 )TransformChannel::ScaleY ][ index ], mChannels[ ( u32 )TransformChannel::ScaleZ ][ index ] );
+
+		return Transform( position, rotation, scale );
+	}
+
+	//==========================================================================
+
+	f32* TransformStream::GetChannel( const TransformChannel& channel )
+	{
+		return mChannels[ ( u32 )channel ].data( );
+	}
+
+	//==========================================================================
+
+	const f32* TransformStream::GetChannel( const TransformChannel& channel ) const
+	{
+		return mChannels[ ( u32 )channel ].data( );
+	}
+
+	//==========================================================================
+
+	void TransformStream::Compose( const TransformStream& local, const TransformStream& parent, TransformStream& out, const u32& begin, const u32& end )
+	{
+		assert( end <= local.GetCount( ) && end <= parent.GetCount( ) && end <= out.GetCount( ) );
+
+		u32 i = begin;
+#if ENJON_MATH_SSE
+		for ( ; i + 4 <= end; i += 4 ) ComposeAt< Lanes4 >( local, parent, out, i );
+#endif
+		for ( ; i < end; ++i ) ComposeAt< f32 >( local, parent, out, i );
+	}
+
+	//==========================================================================
+
+	void TransformStream::InverseCompose( const TransformStream& world, const TransformStream& parent, TransformStream& out, const u32& begin, const u32& end )
+	{
+		assert( end <= world.GetCount( ) && end <= parent.GetCount( ) && end <= out.GetCount( ) );
+
+		u32 i = begin;
+#if ENJON_MATH_SSE
+		for ( ; i + 4 <= end; i += 4 ) InverseComposeAt< Lanes4 >( world, parent, out, i );
+#endif
+		for ( ; i < end; ++i ) InverseComposeAt< f32 >( world, parent, out, i );
+	}
+
+	//==========================================================================
+
+	void TransformStream::ToMatrices( const TransformStream& stream, Mat4x4* out, const u32& begin, const u32& end )
+	{
+		assert( end <= stream.GetCount( ) );
+
+		u32 i = begin;
+#if ENJON_MATH_SSE
+		for ( ; i + 4 <= end; i += 4 ) ToMatricesAt< Lanes4 >( stream, out, i );
+#endif
+		for ( ; i < end; ++i ) ToMatricesAt< f32 >( stream, out, i );
+	}
+
+	//==========================================================================
+
+	void TransformStream::TransformPoints( const TransformStream& stream, const Vec3* points, Vec3* out, const u32& begin, const u32& end )
+	{
+		assert( end <= stream.GetCount( ) );
+
+		u32 i = begin;
+#if ENJON_MATH_SSE
+		for ( ; i + 4 <= end; i += 4 ) TransformPointsAt< Lanes4 >( stream, points, out, i );
+#endif
+		for ( ; i < end; ++i ) TransformPointsAt< f32 >( stream, points, out, i );
+	}
+
+	//==========================================================================
+}
@@ -1,4 +1,5 @@
 #include "math/Vec4.h"
+#include "Math/Simd.h"
 
 namespace Enjon {
  
@@ -10,37 +11,25 @@ namespace Enjon {
 
 	Vec4& Vec4::Add(const Vec4& other)
 	{
-		x += other.x;
-		y += other.y;
-		z += other.z;
-		w += other.w;
+		Simd::Active::Add4( data, other.data, data );
 		return *this;
 	} 
 	
 	Vec4& Vec4::Subtract(const Vec4& other)
 	{
-		x -= other.x;
-		y -= other.y;
-		z -= other.z;
-		w -= other.w;
+		Simd::Active::Subtract4( data, other.data, data );
 		return *this;
 	}
 	
 	Vec4& Vec4::Multiply(const Vec4& other)
 	{
-		x *= other.x;
-		y *= other.y;
-		z *= other.z;
-		w *= other.w;
+		Simd::Active::Multiply4( data, other.data, data );
 		return *this;
 	}
 	
 	Vec4& Vec4::Divide(const Vec4& other)
 	{
-		x /= other.x;
-		y /= other.y;
-		z /= other.z;
-		w /= other.w;
+		Simd::Active::Divide4( data, other.data, data );
 		return *this;
 	}
 
@@ -117,7 +106,7 @@ namespace Enjon {
 
 	float Vec4::Length() const 
 	{
-		return sqrt((x * x) + (y * y) + (z * z) + (w * w));
+		return sqrt( Simd::Active::Dot4( data, data ) );
 	}
 		
 	Vec4 operator/(Vec4 left, float value)
@@ -132,12 +121,14 @@ namespace Enjon {
 
 	float Vec4::Dot(const Vec4& other)
 	{
-		return x * other.x + y * other.y + z * other.z + w * other.w;
+		return Simd::Active::Dot4( data, other.data );
 	}
 			
 	Vec4 Vec4::Normalize(const Vec4& vec) 
 	{ 
-		return vec / vec.Length(); 
+		Vec4 result;
+		Simd::Active::Normalize4( vec.data, result.data );
+		return result;
 	}
 
 	Vec3 Vec4::XYZ()
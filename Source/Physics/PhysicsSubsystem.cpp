@@ -258,6 +258,13 @@ namespace Enjon
 			mContactEvents.erase( comp );
 		} 
 
+		// Scrub all values at once at end of batch
+		if ( mBatchedRemoval )
+		{
+			mPendingContactRemovals.insert( comp );
+			return;
+		}
+
 		// Now the tricky part; Have to iterate value instances for this comp as well
 		for ( auto& k : mContactEvents )
 		{
@@ -267,6 +274,49 @@ namespace Enjon
 
 	//====================================================================== 
 
+	void PhysicsSubsystem::BeginBatchedRemoval( )
+	{
+		mBatchedRemoval = true;
+	}
+
+	//====================================================================== 
+
+	void PhysicsSubsystem::EndBatchedRemoval( )
+	{
+		if ( !mBatchedRemoval )
+		{
+			return;
+		}
+
+		mBatchedRemoval = false;
+
+		if ( mPendingContactRemovals.empty( ) )
+		{
+			return;
+		}
+
+		// Single pass over remaining contact sets
+		for ( auto& k : mContactEvents )
+		{
+			HashSet< RigidBodyComponent* >& contacts = k.second;
+			for ( auto it = contacts.begin( ); it != contacts.end( ); )
+			{
+				if ( mPendingContactRemovals.find( *it ) != mPendingContactRemovals.end( ) )
+				{
+					it = contacts.erase( it );
+				}
+				else
+				{
+					++it;
+				}
+			}
+		}
+
+		mPendingContactRemovals.clear( );
+	}
+
+	//====================================================================== 
+
 	bool PhysicsSubsystem::HasContact( RigidBodyComponent* component )
 	{
 		return ( mContactEvents.find( component ) != mContactEvents.end( ) );
@@ -16,6 +16,8 @@
 #include "Defines.h"
 #include "SubsystemCatalog.h"
 
+#include <cstring>
+
 namespace Enjon
 { 
 	//==================================================================================================================
@@ -486,6 +488,12 @@ namespace Enjon
 						READ_PROP( buffer, cls, object, prop, f32 )
 					} break;
 
+					case MetaPropertyType::F64:
+					{
+						// Set value of object from read buffer
+						READ_PROP( buffer, cls, object, prop, f64 )
+					} break;
+
 					case MetaPropertyType::String:
 					{
 						READ_PROP( buffer, cls, object, prop, String )
@@ -624,6 +632,7 @@ namespace Enjon
 						scale.x = buffer->Read< f32 >( );
 						scale.y = buffer->Read< f32 >( );
 						scale.z = buffer->Read< f32 >( );
+						val.SetScale( scale );
 
 						// Set transform property
 						cls->SetValue( object, prop, val ); 
@@ -832,4 +841,177 @@ namespace Enjon
 				buffer->AdvanceReadPosition( propSize );
 			} 
 	}
+
+	//==================================================================================================================
+
+#define COPY_PROP( cls, source, dest, prop, valType )\
+	cls->SetValue( dest, prop, *cls->GetValueAs< valType >( source, prop ) );
+
+	INTERNAL usize GetPODPropertySize( const MetaPropertyType& type )
+	{
+		switch ( type )
+		{
+			case MetaPropertyType::U8:			return sizeof( u8 );
+			case MetaPropertyType::U16:			return sizeof( u16 );
+			case MetaPropertyType::U32:			return sizeof( u32 );
+			case MetaPropertyType::U64:			return sizeof( u64 );
+			case MetaPropertyType::S8:			return sizeof( s8 );
+			case MetaPropertyType::S16:			return sizeof( s16 );
+			case MetaPropertyType::S32:			return sizeof( s32 );
+			case MetaPropertyType::S64:			return sizeof( s64 );
+			case MetaPropertyType::F32:			return sizeof( f32 );
+			case MetaPropertyType::F64:			return sizeof( f64 );
+			case MetaPropertyType::Bool:		return sizeof( bool );
+			case MetaPropertyType::Enum:		return sizeof( s32 );
+			case MetaPropertyType::iVec3:		return sizeof( iVec3 );
+			case MetaPropertyType::Vec2:		return sizeof( Vec2 );
+			case MetaPropertyType::Vec3:		return sizeof( Vec3 );
+			case MetaPropertyType::Vec4:		return sizeof( Vec4 );
+			case MetaPropertyType::ColorRGBA32:	return sizeof( ColorRGBA32 );
+			default:							return 0;
+		}
+	}
+
+	//==================================================================================================================
+
+	void PropertyArchiver::Copy( const Object* source, const Object* dest, const MetaProperty* prop )
+	{
+		// Both objects share the same class, so property offsets are identical
+		const MetaClass* cls = dest->Class( );
+
+		// Plain values without any callbacks to run can just be copied over
+		usize podSize = GetPODPropertySize( prop->GetType( ) );
+		if ( podSize && !prop->HasValueCallbacks( ) && !prop->GetTraits( ).IsPointer( ) )
+		{
+			std::memcpy( ( void* )( usize( dest ) + prop->GetOffset( ) ), ( const void* )( usize( source ) + prop->GetOffset( ) ), podSize );
+			return;
+		}
+
+		switch ( prop->GetType( ) )
+		{
+			case MetaPropertyType::U8:			{ COPY_PROP( cls, source, dest, prop, u8 ) } break;
+			case MetaPropertyType::U16:			{ COPY_PROP( cls, source, dest, prop, u16 ) } break;
+			case MetaPropertyType::U32:			{ COPY_PROP( cls, source, dest, prop, u32 ) } break;
+			case MetaPropertyType::U64:			{ COPY_PROP( cls, source, dest, prop, u64 ) } break;
+			case MetaPropertyType::S8:			{ COPY_PROP( cls, source, dest, prop, s8 ) } break;
+			case MetaPropertyType::S16:			{ COPY_PROP( cls, source, dest, prop, s16 ) } break;
+			case MetaPropertyType::S32:			{ COPY_PROP( cls, source, dest, prop, s32 ) } break;
+			case MetaPropertyType::S64:			{ COPY_PROP( cls, source, dest, prop, s64 ) } break;
+			case MetaPropertyType::F32:			{ COPY_PROP( cls, source, dest, prop, f32 ) } break;
+			case MetaPropertyType::F64:			{ COPY_PROP( cls, source, dest, prop, f64 ) } break;
+			case MetaPropertyType::Bool:		{ COPY_PROP( cls, source, dest, prop, bool ) } break;
+			case MetaPropertyType::Enum:		{ COPY_PROP( cls, source, dest, prop, s32 ) } break;
+			case MetaPropertyType::iVec3:		{ COPY_PROP( cls, source, dest, prop, iVec3 ) } break;
+			case MetaPropertyType::Vec2:		{ COPY_PROP( cls, source, dest, prop, Vec2 ) } break;
+			case MetaPropertyType::Vec3:		{ COPY_PROP( cls, source, dest, prop, Vec3 ) } break;
+			case MetaPropertyType::Vec4:		{ COPY_PROP( cls, source, dest, prop, Vec4 ) } break;
+			case MetaPropertyType::ColorRGBA32:	{ COPY_PROP( cls, source, dest, prop, ColorRGBA32 ) } break;
+			case MetaPropertyType::String:		{ COPY_PROP( cls, source, dest, prop, String ) } break;
+			case MetaPropertyType::UUID:		{ COPY_PROP( cls, source, dest, prop, UUID ) } break;
+
+			case MetaPropertyType::Transform:
+			{
+				// Only position, rotation and scale are archived, so rebuild the transform from those
+				const Transform* src = cls->GetValueAs< Transform >( source, prop );
+
+				Transform val;
+				val.SetPosition( src->GetPosition( ) );
+				val.SetRotation( src->GetRotation( ) );
+				val.SetScale( src->GetScale( ) );
+
+				cls->SetValue( dest, prop, val );
+			} break;
+
+			case MetaPropertyType::AssetHandle:
+			{
+				const MetaPropertyTemplateBase* base = prop->Cast< MetaPropertyTemplateBase >( );
+				const AssetManager* am = EngineSubsystem( AssetManager );
+				const MetaClass* assetCls = base->GetClassOfTemplatedArgument( );
+
+				AssetHandle< Asset > src;
+				cls->GetValue( source, prop, &src );
+
+				// Resolve through the asset manager so invalid handles fall back to the default asset like they do when deserialized
+				const Asset* asset = am->GetAsset( assetCls, src ? src.GetUUID( ) : UUID::Invalid( ) );
+
+				AssetHandle< Asset > val;
+				val.Set( asset ? asset : am->GetDefaultAsset( assetCls ) );
+
+				cls->SetValue( dest, prop, val );
+			} break;
+
+	# define COPY_ARRAY_PROP_PRIM( source, dest, prop, valType, arraySize )\
+		{\
+			const MetaPropertyArray< valType >* arrayProp = prop->Cast< MetaPropertyArray< valType > >();\
+			for ( usize j = 0; j < arraySize; ++j )\
+			{\
+				arrayProp->SetValueAt( dest, j, arrayProp->GetValueAs( source, j ) );\
+			}\
+		} 
+
+			case MetaPropertyType::Array:
+			{
+				const MetaPropertyArrayBase* base = prop->Cast< MetaPropertyArrayBase >( );
+
+				// Arrays of objects own their elements, so let the archiver construct them
+				if ( base->GetArrayType( ) == MetaPropertyType::Object )
+				{
+					CopyArchived( source, dest, prop );
+					return;
+				}
+
+				usize arraySize = base->GetSize( source );
+
+				if ( base->GetArraySizeType( ) == ArraySizeType::Dynamic )
+				{
+					base->Resize( dest, arraySize );
+				}
+
+				switch ( base->GetArrayType( ) )
+				{
+					case MetaPropertyType::Bool:	COPY_ARRAY_PROP_PRIM( source, dest, base, bool, arraySize )		break;
+					case MetaPropertyType::U8:		COPY_ARRAY_PROP_PRIM( source, dest, base, u8, arraySize )		break;
+					case MetaPropertyType::U32:		COPY_ARRAY_PROP_PRIM( source, dest, base, u32, arraySize )		break;
+					case MetaPropertyType::S32:		COPY_ARRAY_PROP_PRIM( source, dest, base, s32, arraySize )		break;
+					case MetaPropertyType::F32:		COPY_ARRAY_PROP_PRIM( source, dest, base, f32, arraySize )		break;
+					case MetaPropertyType::F64:		COPY_ARRAY_PROP_PRIM( source, dest, base, f64, arraySize )		break;
+					case MetaPropertyType::String:	COPY_ARRAY_PROP_PRIM( source, dest, base, String, arraySize )	break;
+					case MetaPropertyType::UUID:	COPY_ARRAY_PROP_PRIM( source, dest, base, UUID, arraySize )		break;
+
+					case MetaPropertyType::AssetHandle:
+					{
+						MetaArrayPropertyProxy proxy = base->GetProxy( );
+						const MetaPropertyTemplateBase* arrBase = static_cast< const MetaPropertyTemplateBase* > ( proxy.mArrayPropertyTypeBase );
+						const MetaClass* assetCls = arrBase->GetClassOfTemplatedArgument( );
+						AssetManager* am = EngineSubsystem( AssetManager );
+
+						const MetaPropertyArray< AssetHandle< Asset > >* arrProp = base->Cast< MetaPropertyArray< AssetHandle< Asset > > >( );
+						for ( usize j = 0; j < arraySize; ++j )
+						{
+							AssetHandle< Asset > src;
+							arrProp->GetValueAt( source, j, &src );
+							arrProp->SetValueAt( dest, j, am->GetAsset( assetCls, src ? src->GetUUID( ) : UUID::Invalid( ) ) );
+						}
+					} break;
+				}
+			} break;
+
+			// Owned objects, entity handles and maps go through the archiver for this property only
+			default:
+			{
+				CopyArchived( source, dest, prop );
+			} break;
+		}
+	}
+
+	//==================================================================================================================
+
+	void PropertyArchiver::CopyArchived( const Object* source, const Object* dest, const MetaProperty* prop )
+	{
+		ByteBuffer temp;
+		Serialize( source, prop, &temp );
+		Deserialize( dest, &temp );
+	}
+
+	//==================================================================================================================
 }
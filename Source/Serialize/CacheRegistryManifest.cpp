@@ -180,7 +180,7 @@ namespace Enjon
 
 	bool CacheRegistryManifest::HasRecord( const UUID& uuid )
 	{
-		return ( mManifestRecords.find( uuid.ToString() ) != mManifestRecords.end( ) );
+		return ( mManifestRecords.find( uuid ) != mManifestRecords.end( ) );
 	}
 
 	//=========================================================================================
@@ -189,7 +189,7 @@ namespace Enjon
 	{
 		if ( !HasRecord( record.mAssetUUID ) )
 		{
-			mManifestRecords[record.mAssetUUID.ToString()] = record;
+			mManifestRecords[record.mAssetUUID] = record;
 
 			return Result::SUCCESS;
 		}
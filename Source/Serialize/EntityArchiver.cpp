@@ -362,27 +362,194 @@ namespace Enjon
 			ObjectArchiver::ClearAllPropertyOverrides( ent );
 
 			// Record all property overrides
-			ObjectArchiver::RecordAllPropertyOverrides( ent->mPrototypeEntity.Get( ), ent );
+			ObjectArchiver::RecordAllPropertyOverrides( ent->GetPrototypeEntity( ).Get( ), ent );
 
 			// Merge objects 
-			ObjectArchiver::MergeObjects( ent->mPrototypeEntity.Get( ), ent, MergeType::AcceptMerge );
+			ObjectArchiver::MergeObjects( ent->GetPrototypeEntity( ).Get( ), ent, MergeType::AcceptMerge );
+
+			// Read shared properties that weren't overridden through to the prototype again
+			RelinkSharedComponents( ent );
 		} 
 
 		return ent;
 	}
 
 	//========================================================================================= 
-}
 
+	EntityHandle EntityArchiver::Clone( const EntityHandle& source, World* world, bool isInstanced, Vector< Entity* >* clonedEntities )
+	{
+		Entity* sourceEnt = source.Get( );
 
+		// Nothing to clone
+		if ( !sourceEnt )
+		{
+			return EntityHandle( );
+		}
 
+		// Get entity manager from engine
+		EntityManager* entities = EngineSubsystem( EntityManager );
 
+		// Handle to fill out
+		EntityHandle handle = entities->Allocate( world );
 
+		// Continue to clone data into entity
+		return EntityArchiver::CloneInternal( sourceEnt, handle, world, isInstanced, clonedEntities );
+	}
 
+	//========================================================================================= 
 
+	void EntityArchiver::RelinkSharedComponents( Entity* entity )
+	{
+		Entity* prototype = entity->GetPrototypeEntity( ).Get( );
+		if ( !prototype )
+		{
+			return;
+		}
 
+		for ( auto& c : entity->GetComponents( ) )
+		{
+			Component* source = prototype->GetComponent( c->Class( ) );
+			if ( !source || c->GetSharedSource( ) )
+			{
+				continue;
+			}
 
+			// Writes detach the whole component, so a single overridden shared property keeps it detached
+			const MetaClass* cls = c->Class( );
+			bool overridden = false;
+			for ( usize i = 0; i < cls->GetPropertyCount( ) && !overridden; ++i )
+			{
+				const MetaProperty* prop = cls->GetProperty( i );
+				overridden = prop && prop->HasFlags( MetaPropertyFlags::InstanceShared ) && prop->HasOverride( c );
+			}
 
+			if ( !overridden )
+			{
+				c->SetSharedSource( source );
+			}
+		}
+	}
 
+	//========================================================================================= 
 
+	EntityHandle EntityArchiver::CloneInternal( Entity* source, const EntityHandle& handle, World* world, bool isInstanced, Vector< Entity* >* clonedEntities )
+	{
+		// Mirrors DeserializeInternal() step for step, reading from the source entity instead of a buffer
+		AssetManager* am = EngineSubsystem( AssetManager );
 
+		// Get the entity
+		Entity* ent = handle.Get( );
+
+		// Record in pre-order
+		if ( clonedEntities )
+		{
+			clonedEntities->push_back( ent );
+		}
+
+		// Set the transform of the entity
+		ent->SetLocalTransform( source->GetLocalTransform( ) );
+
+		// Clones never share ids with their source. The freshly allocated entity already has a new UUID in the uuid map, so keep it.
+
+		// Copy name
+		ent->SetName( source->GetName( ) );
+
+		// Copy archetype
+		ent->SetArchetype( source->GetArchetype( ) );
+
+		// Copy prototype entity
+		if ( source->HasPrototypeEntity( ) )
+		{
+			ent->SetPrototypeEntity( source->GetPrototypeEntity( ) );
+		}
+
+		// If archetype is default, remove the archetype and then set the id to invalid
+		if ( ent->GetArchetype( ) == am->GetDefaultAsset< Archetype >( ) || !ent->GetArchetype( ) )
+		{
+			ent->SetArchetype( nullptr );
+			ent->SetPrototypeEntity( EntityHandle::Invalid( ) );
+		}
+
+		// Only set prototype entities IFF we're not instancing this entity from another source
+		if ( !isInstanced )
+		{
+			for ( auto& e : source->GetInstancedEntities( ) )
+			{
+				if ( e )
+				{
+					e.Get( )->SetPrototypeEntity( ent );
+				}
+			}
+		}
+
+		//=================================================================
+		// Components
+		//=================================================================
+
+		for ( auto& c : source->GetComponents( ) )
+		{
+			// Attach new component to entity using MetaClass
+			const MetaClass* cmpCls = c->Class( );
+			Component* cmp = ent->AddComponent( cmpCls );
+			if ( cmp )
+			{
+				// Instances read InstanceShared properties through to the source's component instead of copying them
+				bool shared = isInstanced && cmp->SetSharedSource( c );
+
+				Result res = cmp->CopyData( c );
+				if ( res == Result::INCOMPLETE )
+				{
+					res = CopyObjectDataDefault( c, cmp, cmpCls, shared );
+				}
+
+				// Late init, same as after deserializing
+				cmp->DeserializeLateInit( );
+			}
+		}
+
+		//=================================================================
+		// Entity Children
+		//=================================================================
+
+		for ( auto& c : source->GetChildren( ) )
+		{
+			// Children of an instanced entity are instanced as well, so they never take over the source's instances
+			EntityHandle child = Clone( c, world, isInstanced, clonedEntities );
+			Entity* childEnt = child.Get( );
+			if ( childEnt )
+			{
+				// Grab local transform of child that was just cloned
+				Transform localTrans = childEnt->GetLocalTransform( );
+
+				// After adding child, local transform will be incorrect
+				ent->AddChild( child );
+
+				// Restore local transform
+				childEnt->SetLocalTransform( localTrans );
+			}
+		}
+
+		// Copy object default
+		CopyObjectDataDefault( source, ent, ent->Class( ) );
+
+		// If prototype entity, then record all property overrides and then attempt merge
+		if ( ent->HasPrototypeEntity() && !isInstanced )
+		{
+			// Clear all property overrides
+			ObjectArchiver::ClearAllPropertyOverrides( ent );
+
+			// Record all property overrides
+			ObjectArchiver::RecordAllPropertyOverrides( ent->GetPrototypeEntity( ).Get( ), ent );
+
+			// Merge objects 
+			ObjectArchiver::MergeObjects( ent->GetPrototypeEntity( ).Get( ), ent, MergeType::AcceptMerge );
+
+			// Read shared properties that weren't overridden through to the prototype again
+			RelinkSharedComponents( ent );
+		} 
+
+		return ent;
+	}
+
+	//========================================================================================= 
+}
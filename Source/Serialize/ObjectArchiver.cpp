@@ -102,8 +102,8 @@ namespace Enjon
 				continue;
 			}
 
-			// Serialize out the property
-			PropertyArchiver::Serialize( object, prop, buffer );
+			// Serialize out the property, shared values are written out as if they were the object's own
+			PropertyArchiver::Serialize( object->GetPropertySource( prop ), prop, buffer );
 		}
 
 		return Result::SUCCESS;
@@ -367,6 +367,56 @@ namespace Enjon
 
 	//===========================================================
 
+	Result ObjectArchiver::Copy( const Object* source, Object* dest )
+	{
+		if ( !source || !dest || source->Class( ) != dest->Class( ) )
+		{
+			return Result::FAILURE;
+		}
+
+		// Classes can override how they copy their data, same as with serialization
+		Result res = dest->CopyData( source );
+		if ( res == Result::INCOMPLETE )
+		{
+			res = CopyObjectDataDefault( source, dest, dest->Class( ) );
+		}
+
+		// Late init after copying, same as after deserializing
+		if ( res == Result::SUCCESS )
+		{
+			dest->DeserializeLateInit( );
+		}
+
+		return res;
+	}
+
+	//===========================================================
+
+	Result ObjectArchiver::CopyObjectDataDefault( const Object* source, const Object* dest, const MetaClass* cls, bool skipInstanceShared )
+	{
+		for ( usize i = 0; i < cls->GetPropertyCount( ); ++i )
+		{
+			const MetaProperty* prop = cls->GetProperty( i );
+
+			// Only copy what would have been serialized
+			if ( !prop || prop->HasFlags( MetaPropertyFlags::NonSerializeable ) )
+			{
+				continue;
+			}
+
+			if ( skipInstanceShared && prop->HasFlags( MetaPropertyFlags::InstanceShared ) )
+			{
+				continue;
+			}
+
+			PropertyArchiver::Copy( source->GetPropertySource( prop ), dest, prop );
+		}
+
+		return Result::SUCCESS;
+	}
+
+	//===========================================================
+
 	Result ObjectArchiver::WriteToFile( const String& filePath )
 	{ 
 		mBuffer.WriteToFile( filePath ); 
@@ -417,24 +467,35 @@ namespace Enjon
 			// Maybe same as "IsSerializeable"? 
 			if ( prop->IsSerializeable() )
 			{
+				// Read from wherever the objects actually keep the value
+				Object* sourceObj = const_cast< Object* >( source->GetPropertySource( prop ) );
+				Object* destObj = const_cast< Object* >( dest->GetPropertySource( prop ) );
+
 				switch( mergeType )
 				{
 					case MergeType::AcceptSource:
 					{
-						MergeProperty( source, dest, prop, mergeType );
+						// Destination reading through to a shared value has nothing of its own to merge into
+						if ( destObj == dest )
+						{
+							MergeProperty( sourceObj, dest, prop, mergeType );
+						}
 					} break;
 
 					case MergeType::AcceptDestination:
 					{
-						MergeProperty( dest, source, prop, mergeType );
+						if ( sourceObj == source )
+						{
+							MergeProperty( destObj, source, prop, mergeType );
+						}
 					} break;
 
 					case MergeType::AcceptMerge:
 					{
 						// Only merge iff destination object doesn't have a property override
-						if ( !prop->HasOverride( dest ) )
+						if ( destObj == dest && !prop->HasOverride( dest ) )
 						{
-							MergeProperty( source, dest, prop, mergeType );
+							MergeProperty( sourceObj, dest, prop, mergeType );
 						}
 					} break;
 				}
@@ -33,6 +33,7 @@ THE SOFTWARE.
 #include <sstream>
 #include <string>
 #include <iomanip>
+#include <cstring>
 
 // If windows
 #ifdef ENJON_SYSTEM_WINDOWS 
@@ -66,13 +67,18 @@ namespace Enjon
 
 	//==================================================================== 
 
+	// Invalid uuids are filled with '0' characters, which is what existing serialized data holds for them
+	INTERNAL const u8 gInvalidUUIDBytes[ 16 ] = 
+	{ 
+		'0', '0', '0', '0', '0', '0', '0', '0', 
+		'0', '0', '0', '0', '0', '0', '0', '0' 
+	};
+
+	//====================================================================
+
 	UUID::UUID( )
 	{
-		// Fill bytes with '0'
-		for ( u32 i = 0; i < 16; ++i )
-		{
-			mBytes.push_back( '0' );
-		}
+		std::memcpy( mBytes, gInvalidUUIDBytes, sizeof( mBytes ) );
 	}
 
 	//====================================================================
@@ -82,10 +88,12 @@ namespace Enjon
 		//GuidGenerator gen;
 		//mID = Guid( string );
 
-		mBytes.clear( );
+		// Any bytes not present in string are left invalid
+		std::memcpy( mBytes, gInvalidUUIDBytes, sizeof( mBytes ) );
 
 		s8 charOne, charTwo;
 		bool lookingForFirstChar = true;
+		u32 byteCount = 0;
 
 		for ( const s8 &ch : string )
 		{
@@ -101,8 +109,13 @@ namespace Enjon
 			{
 				charTwo = ch;
 				auto byte = hexPairToChar( charOne, charTwo );
-				mBytes.push_back( byte );
+				mBytes[ byteCount++ ] = byte;
 				lookingForFirstChar = true;
+
+				if ( byteCount == sizeof( mBytes ) )
+				{
+					break;
+				}
 			}
 		}
 	}
@@ -142,7 +155,7 @@ namespace Enjon
 
 	UUID::UUID( const u8* bytes )
 	{
-		mBytes.assign( bytes, bytes + 16 );
+		std::memcpy( mBytes, bytes, sizeof( mBytes ) );
 	}
 
 	//====================================================================
@@ -159,7 +172,7 @@ namespace Enjon
 
 	UUID::operator bool( ) const
 	{
-		return ( ToString( ).compare( UUID::Invalid( ).ToString( ) ) != 0 );
+		return std::memcmp( mBytes, gInvalidUUIDBytes, sizeof( mBytes ) ) != 0;
 	}
 
 	//====================================================================
@@ -183,7 +196,7 @@ namespace Enjon
 
 	UUID &UUID::operator=( const UUID &other )
 	{
-		mBytes = other.mBytes;
+		std::memcpy( mBytes, other.mBytes, sizeof( mBytes ) );
 		return *this;
 	}
 
@@ -191,7 +204,7 @@ namespace Enjon
 
 	bool UUID::operator==( const UUID &other ) const
 	{
-		return mBytes == other.mBytes;
+		return std::memcmp( mBytes, other.mBytes, sizeof( mBytes ) ) == 0;
 	}
 
 	//====================================================================
@@ -203,6 +216,25 @@ namespace Enjon
 
 	//====================================================================
 
+	bool UUID::operator<( const UUID &other ) const 
+	{
+		return std::memcmp( mBytes, other.mBytes, sizeof( mBytes ) ) < 0;
+	}
+
+	//====================================================================
+
+	usize UUID::Hash( ) const
+	{
+		u64 lo, hi;
+		std::memcpy( &lo, mBytes, sizeof( u64 ) );
+		std::memcpy( &hi, mBytes + sizeof( u64 ), sizeof( u64 ) );
+
+		// Generated uuids are already well distributed, so mixing both halves is enough
+		return ( usize )( lo ^ ( hi * 0x9E3779B97F4A7C15ull ) );
+	}
+
+	//====================================================================
+
 #ifdef ENJON_SYSTEM_WINDOWS
 	UUID UUID::NewUUID( )
 	{ 
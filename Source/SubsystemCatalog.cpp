@@ -8,6 +8,7 @@
 #include "Graphics/GraphicsSubsystem.h"
 #include "ImGui/ImGuiManager.h"
 #include "IO/InputManager.h"
+#include "System/JobSystem.h"
 
 #include <assert.h>
 
@@ -15,6 +16,9 @@ namespace Enjon
 { 
 	SubsystemCatalog* SubsystemCatalog::mInstance = nullptr;
 
+	// Starts past the generation caches are zero initialized with, so nothing reads as filled before first catalog
+	u32 SubsystemCatalog::mGeneration = 1;
+
 	//======================================================================================================
 
 	SubsystemCatalog::SubsystemCatalog()
@@ -31,6 +35,7 @@ namespace Enjon
 		// NOTE(): Need to explicit in ordering of shutdowns to prevent crashes!
 
 		EngineSubsystem( EntityManager )->Shutdown( ); 
+		EngineSubsystem( JobSystem )->Shutdown( );
 		EngineSubsystem( AssetManager )->Shutdown( );
 		EngineSubsystem( Input )->Shutdown( );
 		EngineSubsystem( PhysicsSubsystem )->Shutdown( ); 
@@ -47,6 +52,10 @@ namespace Enjon
 		}
 
 		mSubsystems.clear( );
+
+		// Invalidate cached pointers in every module so nothing resolves to deleted subsystems
+		mGeneration++;
+		mInstance = nullptr;
 	}
 	
 	//======================================================================================================
@@ -0,0 +1,188 @@
+// @file JobSystem.cpp
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#include "System/JobSystem.h"
+
+#include <algorithm>
+
+namespace Enjon
+{
+	// Main thread is always 0, workers are assigned their index on startup
+	static thread_local u32 gCurrentThreadIndex = 0;
+
+	//==========================================================================
+
+	Result JobSystem::Initialize( )
+	{
+		// Leave one hardware thread for the caller, which always helps out while waiting on jobs
+		u32 hardwareThreads = std::thread::hardware_concurrency( );
+		u32 workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+
+		mRunning = true;
+		mWorkers.reserve( workerCount );
+		for ( u32 i = 0; i < workerCount; ++i )
+		{
+			mWorkers.emplace_back( &JobSystem::WorkerLoop, this, i + 1 );
+		}
+
+		return Result::SUCCESS;
+	}
+
+	//==========================================================================
+
+	void JobSystem::Update( const f32 dT )
+	{
+	}
+
+	//==========================================================================
+
+	Result JobSystem::Shutdown( )
+	{
+		{
+			std::unique_lock< std::mutex > lock( mQueueMutex );
+			mRunning = false;
+		}
+
+		mQueueCondition.notify_all( );
+
+		for ( auto& w : mWorkers )
+		{
+			if ( w.joinable( ) )
+			{
+				w.join( );
+			}
+		}
+
+		mWorkers.clear( );
+
+		return Result::SUCCESS;
+	}
+
+	//==========================================================================
+
+	u32 JobSystem::GetCurrentThreadIndex( )
+	{
+		return gCurrentThreadIndex;
+	}
+
+	//==========================================================================
+
+	void JobSystem::WorkerLoop( const u32& threadIndex )
+	{
+		gCurrentThreadIndex = threadIndex;
+
+		while ( true )
+		{
+			Job job;
+
+			{
+				std::unique_lock< std::mutex > lock( mQueueMutex );
+				mQueueCondition.wait( lock, [ this ] { return !mQueue.empty( ) || !mRunning; } );
+
+				// Drain the queue before exiting
+				if ( mQueue.empty( ) )
+				{
+					return;
+				}
+
+				job = std::move( mQueue.front( ) );
+				mQueue.pop_front( );
+			}
+
+			job( );
+		}
+	}
+
+	//==========================================================================
+
+	bool JobSystem::ExecuteNextJob( )
+	{
+		Job job;
+
+		{
+			std::unique_lock< std::mutex > lock( mQueueMutex );
+			if ( mQueue.empty( ) )
+			{
+				return false;
+			}
+
+			job = std::move( mQueue.front( ) );
+			mQueue.pop_front( );
+		}
+
+		job( );
+
+		return true;
+	}
+
+	//==========================================================================
+
+	void JobSystem::RunAndWait( const Vector< Job >& jobs )
+	{
+		if ( jobs.empty( ) )
+		{
+			return;
+		}
+
+		// No workers to hand off to, so just run everything in place
+		if ( !mRunning || mWorkers.empty( ) || jobs.size( ) == 1 )
+		{
+			for ( auto& j : jobs )
+			{
+				j( );
+			}
+
+			return;
+		}
+
+		std::atomic< u32 > remaining( ( u32 )jobs.size( ) );
+
+		{
+			std::unique_lock< std::mutex > lock( mQueueMutex );
+			for ( auto& j : jobs )
+			{
+				const Job* job = &j;
+				mQueue.emplace_back( [ job, &remaining ]( )
+				{
+					( *job )( );
+					remaining.fetch_sub( 1 );
+				} );
+			}
+		}
+
+		mQueueCondition.notify_all( );
+
+		// Help out until all of our jobs are finished
+		while ( remaining.load( ) > 0 )
+		{
+			if ( !ExecuteNextJob( ) )
+			{
+				std::this_thread::yield( );
+			}
+		}
+	}
+
+	//==========================================================================
+
+	void JobSystem::ParallelFor( const u32& count, const u32& batchSize, const ParallelForFunction& func )
+	{
+		if ( !count )
+		{
+			return;
+		}
+
+		u32 batch = std::max( batchSize, 1u );
+
+		Vector< Job > jobs;
+		jobs.reserve( ( count + batch - 1 ) / batch );
+		for ( u32 begin = 0; begin < count; begin += batch )
+		{
+			u32 end = std::min( begin + batch, count );
+			jobs.push_back( [ &func, begin, end ]( ) { func( begin, end ); } );
+		}
+
+		RunAndWait( jobs );
+	}
+
+	//==========================================================================
+}
@@ -0,0 +1,21 @@
+// @file ArchetypeBenchmark.h
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#pragma once
+#ifndef ENJON_TEST_SUITE_ARCHETYPE_BENCHMARK_H
+#define ENJON_TEST_SUITE_ARCHETYPE_BENCHMARK_H
+
+#include <System/Types.h>
+#include <Defines.h>
+
+namespace Enjon
+{
+	/**
+	* @brief Times instanceCount calls to Archetype::Instantiate( ) against a single Archetype::InstantiateBatch( ) call with 
+	*		 instanceCount transforms, prints both and writes them as JSON to outputPath in the entity benchmark format. 
+	*		 Expects the engine to be started up with an application registered. Destroys every entity it creates.
+	*/
+	Result RunArchetypeInstantiateBenchmark( const u32& instanceCount, const u32& iterations, const String& outputPath, const String& revision );
+}
+
+#endif
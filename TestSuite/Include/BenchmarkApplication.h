@@ -0,0 +1,46 @@
+// @file BenchmarkApplication.h
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#pragma once
+#ifndef ENJON_TEST_SUITE_BENCHMARK_APPLICATION_H
+#define ENJON_TEST_SUITE_BENCHMARK_APPLICATION_H
+
+#include <Application.h>
+
+namespace Enjon
+{
+	/**
+	* @brief Empty application registered with the engine while benchmarks run. The engine is only started up, never run,
+	*		 so nothing is ever rendered or ticked outside of the benchmarks themselves.
+	*/
+	class BenchmarkApplication : public Application
+	{
+		public:
+
+			/**
+			* @brief
+			*/
+			virtual Result Initialize( ) override
+			{
+				return Result::SUCCESS;
+			}
+
+			/**
+			* @brief
+			*/
+			virtual Result Update( f32 dt ) override
+			{
+				return Result::PROCESS_RUNNING;
+			}
+
+			/**
+			* @brief
+			*/
+			virtual Result Shutdown( ) override
+			{
+				return Result::SUCCESS;
+			}
+	};
+}
+
+#endif
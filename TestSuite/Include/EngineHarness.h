@@ -0,0 +1,23 @@
+// @file EngineHarness.h
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#pragma once
+#ifndef ENJON_TEST_SUITE_ENGINE_HARNESS_H
+#define ENJON_TEST_SUITE_ENGINE_HARNESS_H
+
+#include <System/Types.h>
+#include <Defines.h>
+
+#include <functional>
+
+namespace Enjon
+{
+	/**
+	* @brief Starts the engine up headless with an empty BenchmarkApplication, rooted at the working directory, calls func
+	*		 and shuts the engine down again. The engine is never run, so no frame is ticked or rendered. Returns what 
+	*		 func returns, or FAILURE if the engine fails to start up.
+	*/
+	Result RunWithEngine( const std::function< Result( ) >& func );
+}
+
+#endif
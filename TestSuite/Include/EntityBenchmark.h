@@ -0,0 +1,81 @@
+// @file EntityBenchmark.h
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#pragma once
+#ifndef ENJON_TEST_SUITE_ENTITY_BENCHMARK_H
+#define ENJON_TEST_SUITE_ENTITY_BENCHMARK_H
+
+#include <System/Types.h>
+#include <Defines.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+
+namespace Enjon
+{
+	/**
+	* @brief Timings of one entity benchmark at one entity count
+	*/
+	struct EntityBenchmarkResult
+	{
+		String mName;
+		u32 mEntityCount = 0;
+		u32 mIterations = 0;
+		f64 mMeanMS = 0.0;
+		f64 mMinMS = 0.0;
+		f64 mMaxMS = 0.0;
+	};
+
+	/**
+	* @brief Times body iterations times and prints the result. Setup runs untimed before each iteration and teardown 
+	*		 untimed after it.
+	*/
+	template < typename SetupFunc, typename BodyFunc, typename TeardownFunc >
+	EntityBenchmarkResult RunEntityBenchmark( const String& name, const u32& entityCount, const u32& iterations, SetupFunc setup, BodyFunc body, TeardownFunc teardown )
+	{
+		using Clock = std::chrono::high_resolution_clock;
+
+		EntityBenchmarkResult result;
+		result.mName = name;
+		result.mEntityCount = entityCount;
+		result.mIterations = iterations;
+		result.mMinMS = std::numeric_limits< f64 >::max( );
+
+		for ( u32 it = 0; it < iterations; ++it )
+		{
+			setup( );
+
+			Clock::time_point start = Clock::now( );
+			body( );
+			f64 ms = std::chrono::duration< f64, std::milli >( Clock::now( ) - start ).count( );
+
+			result.mMeanMS += ms;
+			result.mMinMS = std::min( result.mMinMS, ms );
+			result.mMaxMS = std::max( result.mMaxMS, ms );
+
+			teardown( );
+		}
+
+		result.mMeanMS /= ( f64 )std::max( iterations, 1u );
+
+		std::cout << "\t" << name << " x " << entityCount << ": " << result.mMeanMS << " ms ( min " << result.mMinMS << " ms, max " << result.mMaxMS << " ms )\n";
+
+		return result;
+	}
+
+	/**
+	* @brief Writes results as JSON to outputPath, tagged with the engine revision they were measured on
+	*/
+	Result WriteEntityBenchmarkReport( const Vector< EntityBenchmarkResult >& results, const u32& iterations, const String& outputPath, const String& revision );
+
+	/**
+	* @brief Runs entity and component micro-benchmarks at each entity count, prints them and writes them as JSON to
+	*		 outputPath so runs of different engine revisions can be compared. Expects the engine to be started up with an
+	*		 application registered. Destroys all entities between runs.
+	*/
+	Result RunEntityBenchmarks( const Vector< u32 >& entityCounts, const u32& iterations, const String& outputPath, const String& revision );
+}
+
+#endif
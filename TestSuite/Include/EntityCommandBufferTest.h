@@ -0,0 +1,21 @@
+// @file EntityCommandBufferTest.h
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#pragma once
+#ifndef ENJON_TEST_SUITE_ENTITY_COMMAND_BUFFER_TEST_H
+#define ENJON_TEST_SUITE_ENTITY_COMMAND_BUFFER_TEST_H
+
+#include <System/Types.h>
+
+namespace Enjon
+{
+	/**
+	* @brief Records entity commands into the main thread's command buffer, checks nothing changes until playback and
+	*		 that playback leaves entities and components as the recorded order says. Covers deferred creation,
+	*		 destruction, add / remove ordering, sort keys and commands following a destroy in the same buffer. Prints
+	*		 each case and returns false if any fail. Expects the engine to be started up with an application registered.
+	*/
+	bool RunEntityCommandBufferTest( );
+}
+
+#endif
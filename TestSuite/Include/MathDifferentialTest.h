@@ -0,0 +1,20 @@
+// @file MathDifferentialTest.h
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#pragma once
+#ifndef ENJON_TEST_SUITE_MATH_DIFFERENTIAL_TEST_H
+#define ENJON_TEST_SUITE_MATH_DIFFERENTIAL_TEST_H
+
+#include <System/Types.h>
+
+namespace Enjon
+{
+	/**
+	* @brief Runs every SIMD math kernel and the math classes built on them against the scalar reference kernels with
+	*		 caseCount random inputs each and prints the largest difference found. Returns false if any result differs
+	*		 by more than a small relative tolerance. Doesn't need the engine to be started up.
+	*/
+	bool RunMathDifferentialTest( const u32& caseCount );
+}
+
+#endif
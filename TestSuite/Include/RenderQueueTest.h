@@ -0,0 +1,22 @@
+// @file RenderQueueTest.h
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#pragma once
+#ifndef ENJON_TEST_SUITE_RENDER_QUEUE_TEST_H
+#define ENJON_TEST_SUITE_RENDER_QUEUE_TEST_H
+
+#include <System/Types.h>
+
+namespace Enjon
+{
+	/**
+	* @brief Pushes commandCount random commands into a render queue and checks the sorted order against std::stable_sort
+	*		 of the push order by pass, then shader, material and submesh in first pushed order, then clamped depth. Also
+	*		 checks that shaders, materials and submeshes past what the queue can order sort as one, after the others in
+	*		 their pass, without disturbing any other field. Prints each check and returns false if any fail. Doesn't 
+	*		 need the engine to be started up.
+	*/
+	bool RunRenderQueueTest( const u32& commandCount );
+}
+
+#endif
@@ -0,0 +1,110 @@
+// @file ArchetypeBenchmark.cpp
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#include "ArchetypeBenchmark.h"
+#include "EntityBenchmark.h"
+
+#include <Enjon.h>
+
+#include <iostream>
+
+namespace Enjon
+{
+	//==================================================================================
+
+	// Root with a light and two children with a mesh each, roughly what the wave spawner instantiates
+	INTERNAL void BuildBenchmarkArchetype( Archetype* archetype )
+	{
+		EntityManager* em = EngineSubsystem( EntityManager );
+
+		Entity* root = archetype->GetRootEntity( ).Get( );
+		root->AddComponent< PointLightComponent >( );
+
+		for ( u32 i = 0; i < 2; ++i )
+		{
+			Entity* child = em->Allocate( em->GetArchetypeWorld( ) ).Get( );
+			child->AddComponent< StaticMeshComponent >( );
+			root->AddChild( child );
+		}
+	}
+
+	//==================================================================================
+
+	INTERNAL void DestroyInstances( const Vector< EntityHandle >& instances )
+	{
+		EntityManager* em = EngineSubsystem( EntityManager );
+
+		em->ForceAddEntities( );
+		for ( auto& e : instances )
+		{
+			if ( e )
+			{
+				e.Get( )->Destroy( );
+			}
+		}
+		em->ForceCleanup( );
+	}
+
+	//==================================================================================
+
+	// Template entities are flagged as archetype roots, which Destroy( ) skips, so children go first and each is forced
+	INTERNAL void DestroyTemplateEntity( const EntityHandle& entity )
+	{
+		for ( auto& c : entity.Get( )->GetChildren( ) )
+		{
+			DestroyTemplateEntity( c );
+		}
+
+		entity.Get( )->ForceDestroy( );
+	}
+
+	//==================================================================================
+
+	Result RunArchetypeInstantiateBenchmark( const u32& instanceCount, const u32& iterations, const String& outputPath, const String& revision )
+	{
+		EntityManager* em = EngineSubsystem( EntityManager );
+
+		Archetype archetype;
+		BuildBenchmarkArchetype( &archetype );
+
+		World* world = Engine::GetInstance( )->GetWorld( );
+
+		Vector< Transform > transforms;
+		transforms.reserve( instanceCount );
+		for ( u32 i = 0; i < instanceCount; ++i )
+		{
+			transforms.push_back( Transform( Vec3( ( f32 )i, 0.0f, 0.0f ), Quaternion( ), Vec3( 1.0f ) ) );
+		}
+
+		Vector< EntityHandle > instances;
+		instances.reserve( instanceCount );
+
+		auto clear = [ & ]( ) { instances.clear( ); };
+		auto destroy = [ & ]( ) { DestroyInstances( instances ); };
+
+		std::cout << "Archetype benchmarks: " << instanceCount << " instances, " << iterations << " iterations\n";
+
+		Vector< EntityBenchmarkResult > results;
+
+		results.push_back( RunEntityBenchmark( "ArchetypeInstantiate", instanceCount, iterations, clear, [ & ]( )
+		{
+			for ( auto& t : transforms )
+			{
+				instances.push_back( archetype.Instantiate( t, world ) );
+			}
+		}, destroy ) );
+
+		results.push_back( RunEntityBenchmark( "ArchetypeInstantiateBatch", instanceCount, iterations, clear, [ & ]( )
+		{
+			instances = archetype.InstantiateBatch( transforms, world );
+		}, destroy ) );
+
+		// Template lives in the archetype world and isn't released with the archetype
+		DestroyTemplateEntity( archetype.GetRootEntity( ) );
+		em->ForceCleanup( );
+
+		return WriteEntityBenchmarkReport( results, iterations, outputPath, revision );
+	}
+
+	//==================================================================================
+}
@@ -0,0 +1,53 @@
+// @file BenchmarkMain.cpp
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#include <Enjon.h>
+#include "ArchetypeBenchmark.h"
+#include "EntityBenchmark.h"
+#include "EngineHarness.h"
+
+#include <iostream> 
+
+using namespace Enjon; 
+
+#ifdef main
+	#undef main
+#endif
+int main(int argc, char** argv)
+{ 
+	String mode = argc > 1 ? String( argv[ 1 ] ) : "--entity-benchmark";
+
+	// Archetype instantiation benchmark: --archetype-benchmark [instance count] [output json path] [engine revision]
+	if ( mode == "--archetype-benchmark" )
+	{
+		u32 instanceCount = argc > 2 ? ( u32 )std::stoul( argv[ 2 ] ) : 500;
+		String outputPath = argc > 3 ? String( argv[ 3 ] ) : "ArchetypeBenchmark.json";
+		String revision = argc > 4 ? String( argv[ 4 ] ) : "unknown";
+
+		Result res = RunWithEngine( [ & ]( )
+		{
+			return RunArchetypeInstantiateBenchmark( instanceCount, 10, outputPath, revision );
+		} );
+
+		return res == Result::SUCCESS ? 0 : 1;
+	}
+
+	// Entity layer benchmarks, run when no mode is given: --entity-benchmark [output json path] [engine revision]
+	if ( mode == "--entity-benchmark" )
+	{
+		String outputPath = argc > 2 ? String( argv[ 2 ] ) : "EntityBenchmark.json";
+		String revision = argc > 3 ? String( argv[ 3 ] ) : "unknown";
+
+		Result res = RunWithEngine( [ & ]( )
+		{
+			return RunEntityBenchmarks( { 1000, 10000, 50000 }, 5, outputPath, revision );
+		} );
+
+		return res == Result::SUCCESS ? 0 : 1;
+	}
+
+	std::cout << "Usage: EnjonBenchmark [ --entity-benchmark [output json path] [engine revision] ]\n";
+	std::cout << "                      [ --archetype-benchmark [instance count] [output json path] [engine revision] ]\n";
+
+	return 1;
+}
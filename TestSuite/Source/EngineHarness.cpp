@@ -0,0 +1,37 @@
+// @file EngineHarness.cpp
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#include "EngineHarness.h"
+#include "BenchmarkApplication.h"
+
+#include <Enjon.h>
+
+#include <filesystem>
+
+namespace FS = std::experimental::filesystem; 
+
+namespace Enjon
+{
+	//==================================================================================
+
+	Result RunWithEngine( const std::function< Result( ) >& func )
+	{
+		Engine engine;
+		BenchmarkApplication app;
+		EngineConfig config;
+		config.SetRootPath( FS::current_path( ).string( ) + "/" );
+		config.SetIsStandAloneApplication( true );
+
+		if ( engine.StartUp( &app, config ) != Result::SUCCESS )
+		{
+			return Result::FAILURE;
+		}
+
+		Result res = func( );
+		engine.ShutDown( );
+
+		return res;
+	}
+
+	//==================================================================================
+}
@@ -0,0 +1,254 @@
+// @file EntityBenchmark.cpp
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#include "EntityBenchmark.h"
+
+#include <Enjon.h>
+#include <Base/StaticTypeId.h>
+#include <Utils/json.h>
+
+#include <fstream>
+#include <iostream>
+
+namespace Enjon
+{
+	// Written to by lookups so they can't be optimized away
+	INTERNAL volatile usize gBenchmarkSink = 0;
+
+	// Entities per chain in the hierarchy benchmark
+	INTERNAL const u32 gHierarchyDepth = 4;
+
+	//==================================================================================
+
+	INTERNAL void DestroyBenchmarkEntities( )
+	{
+		EntityManager* em = EngineSubsystem( EntityManager );
+		em->DestroyAll( );
+		em->ForceCleanup( );
+	}
+
+	//==================================================================================
+
+	INTERNAL void AllocateEntities( Vector< EntityHandle >& entities, const u32& count, bool addComponent )
+	{
+		EntityManager* em = EngineSubsystem( EntityManager );
+		World* world = Engine::GetInstance( )->GetWorld( );
+
+		entities.clear( );
+		entities.reserve( count );
+		for ( u32 i = 0; i < count; ++i )
+		{
+			EntityHandle handle = em->Allocate( world );
+			if ( addComponent )
+			{
+				handle.Get( )->AddComponent< PointLightComponent >( );
+			}
+			entities.push_back( handle );
+		}
+	}
+
+	//==================================================================================
+
+	template < typename SetupFunc, typename BodyFunc >
+	INTERNAL EntityBenchmarkResult RunBenchmark( const String& name, const u32& entityCount, const u32& iterations, SetupFunc setup, BodyFunc body )
+	{
+		return RunEntityBenchmark( name, entityCount, iterations, setup, body, DestroyBenchmarkEntities );
+	}
+
+	//==================================================================================
+
+	INTERNAL void RunBenchmarksAtCount( const u32& count, const u32& iterations, Vector< EntityBenchmarkResult >& results )
+	{
+		EntityManager* em = EngineSubsystem( EntityManager );
+		World* world = Engine::GetInstance( )->GetWorld( );
+		u32 componentType = GetStaticTypeId< PointLightComponent >( );
+
+		Vector< EntityHandle > entities;
+		EntityHandle source;
+		ByteBuffer buffer;
+
+		auto none = [ & ]( ) { };
+		auto allocate = [ & ]( ) { AllocateEntities( entities, count, false ); };
+		auto allocateWithComponents = [ & ]( ) { AllocateEntities( entities, count, true ); };
+
+		results.push_back( RunBenchmark( "Allocate", count, iterations, none, [ & ]( )
+		{
+			for ( u32 i = 0; i < count; ++i )
+			{
+				em->Allocate( world );
+			}
+		} ) );
+
+		results.push_back( RunBenchmark( "Destroy", count, iterations, allocate, [ & ]( )
+		{
+			for ( auto& e : entities )
+			{
+				e.Get( )->Destroy( );
+			}
+			em->ForceCleanup( );
+		} ) );
+
+		results.push_back( RunBenchmark( "AddComponent", count, iterations, allocate, [ & ]( )
+		{
+			for ( auto& e : entities )
+			{
+				e.Get( )->AddComponent< PointLightComponent >( );
+			}
+		} ) );
+
+		results.push_back( RunBenchmark( "GetComponent", count, iterations, allocateWithComponents, [ & ]( )
+		{
+			usize sum = 0;
+			for ( auto& e : entities )
+			{
+				sum += ( usize )em->GetComponent< PointLightComponent >( e.Get( ) );
+			}
+			gBenchmarkSink = sum;
+		} ) );
+
+		results.push_back( RunBenchmark( "RemoveComponent", count, iterations, allocateWithComponents, [ & ]( )
+		{
+			for ( auto& e : entities )
+			{
+				e.Get( )->RemoveComponent< PointLightComponent >( );
+			}
+		} ) );
+
+		// Tick lists are rebuilt by the first update after components are added, so that one isn't timed
+		results.push_back( RunBenchmark( "ComponentArrayUpdate", count, iterations, [ & ]( )
+		{
+			allocateWithComponents( );
+			em->GetComponentBase( componentType )->Update( );
+		}, [ & ]( )
+		{
+			em->GetComponentBase( componentType )->Update( );
+		} ) );
+
+		// Chains of gHierarchyDepth entities with every root moved, so the whole hierarchy is recalculated
+		results.push_back( RunBenchmark( "PropagateTransforms", count, iterations, [ & ]( )
+		{
+			allocate( );
+			for ( u32 i = 0; i < count; ++i )
+			{
+				if ( i % gHierarchyDepth )
+				{
+					entities[ i - 1 ].Get( )->AddChild( entities[ i ] );
+				}
+			}
+
+			em->ForceAddEntities( );
+			em->LateUpdate( 0.0f );
+
+			for ( u32 i = 0; i < count; i += gHierarchyDepth )
+			{
+				entities[ i ].Get( )->SetLocalTransform( Transform( Vec3( ( f32 )i, 0.0f, 0.0f ), Quaternion( ), Vec3( 1.0f ) ), false );
+			}
+		}, [ & ]( )
+		{
+			em->LateUpdate( 0.0f );
+		} ) );
+
+		// Source with a component and a child, instanced count times
+		results.push_back( RunBenchmark( "InstanceEntity", count, iterations, [ & ]( )
+		{
+			source = em->Allocate( world );
+			source.Get( )->AddComponent< PointLightComponent >( );
+			source.Get( )->AddChild( em->Allocate( world ) );
+		}, [ & ]( )
+		{
+			for ( u32 i = 0; i < count; ++i )
+			{
+				em->InstanceEntity( source, world );
+			}
+		} ) );
+
+		// Same layout Scene::SerializeData writes, over the benchmark's root entities
+		results.push_back( RunBenchmark( "SceneSerialize", count, iterations, [ & ]( )
+		{
+			allocateWithComponents( );
+			buffer.Reset( );
+		}, [ & ]( )
+		{
+			buffer.Write< u32 >( ( u32 )entities.size( ) );
+			for ( auto& e : entities )
+			{
+				EntityArchiver::Serialize( e, &buffer );
+			}
+		} ) );
+
+		results.push_back( RunBenchmark( "SceneDeserialize", count, iterations, [ & ]( )
+		{
+			allocateWithComponents( );
+			buffer.Reset( );
+			buffer.Write< u32 >( ( u32 )entities.size( ) );
+			for ( auto& e : entities )
+			{
+				EntityArchiver::Serialize( e, &buffer );
+			}
+
+			// Deserialized entities reuse the serialized uuids
+			DestroyBenchmarkEntities( );
+			buffer.SetReadPosition( 0 );
+		}, [ & ]( )
+		{
+			u32 rootCount = buffer.Read< u32 >( );
+			for ( u32 i = 0; i < rootCount; ++i )
+			{
+				EntityArchiver::Deserialize( &buffer );
+			}
+		} ) );
+	}
+
+	//==================================================================================
+
+	Result RunEntityBenchmarks( const Vector< u32 >& entityCounts, const u32& iterations, const String& outputPath, const String& revision )
+	{
+		// Start from an empty entity manager
+		DestroyBenchmarkEntities( );
+
+		Vector< EntityBenchmarkResult > results;
+		for ( auto& count : entityCounts )
+		{
+			std::cout << "Entity benchmarks: " << count << " entities, " << iterations << " iterations\n";
+			RunBenchmarksAtCount( count, iterations, results );
+		}
+
+		return WriteEntityBenchmarkReport( results, iterations, outputPath, revision );
+	}
+
+	//==================================================================================
+
+	Result WriteEntityBenchmarkReport( const Vector< EntityBenchmarkResult >& results, const u32& iterations, const String& outputPath, const String& revision )
+	{
+		nlohmann::json report;
+		report[ "revision" ] = revision;
+		report[ "iterations" ] = iterations;
+		report[ "results" ] = nlohmann::json::array( );
+
+		for ( auto& r : results )
+		{
+			nlohmann::json entry;
+			entry[ "name" ] = r.mName;
+			entry[ "entities" ] = r.mEntityCount;
+			entry[ "mean_ms" ] = r.mMeanMS;
+			entry[ "min_ms" ] = r.mMinMS;
+			entry[ "max_ms" ] = r.mMaxMS;
+			entry[ "mean_ns_per_entity" ] = r.mEntityCount ? r.mMeanMS * 1000000.0 / ( f64 )r.mEntityCount : 0.0;
+			report[ "results" ].push_back( entry );
+		}
+
+		std::ofstream file( outputPath );
+		if ( !file )
+		{
+			std::cout << "Could not write entity benchmark results to " << outputPath << "\n";
+			return Result::FAILURE;
+		}
+
+		file << report.dump( 4 ) << "\n";
+		std::cout << "Entity benchmark results written to " << outputPath << "\n";
+
+		return Result::SUCCESS;
+	}
+
+	//==================================================================================
+}
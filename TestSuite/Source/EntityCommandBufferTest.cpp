@@ -0,0 +1,224 @@
+// @file EntityCommandBufferTest.cpp
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#include "EntityCommandBufferTest.h"
+
+#include <Enjon.h>
+
+#include <iostream>
+
+namespace Enjon
+{
+	//==================================================================================
+
+	INTERNAL bool CheckCase( const char* name, const bool& passed )
+	{
+		std::cout << "\t" << name << ": " << ( passed ? "ok" : "FAILED" ) << "\n";
+		return passed;
+	}
+
+	//==================================================================================
+
+	INTERNAL bool IsAlive( const EntityHandle& entity )
+	{
+		Entity* ent = entity.Get( );
+		return ent && ent->GetState( ) == EntityState::ACTIVE;
+	}
+
+	//==================================================================================
+
+	// Created entity is only known through the components added to it, so grab its handle from there
+	INTERNAL std::function< void( PointLightComponent* ) > CaptureEntity( EntityHandle* out )
+	{
+		return [ out ]( PointLightComponent* c )
+		{
+			*out = c->GetEntity( )->GetHandle( );
+		};
+	}
+
+	//==================================================================================
+
+	INTERNAL bool TestDeferredCreate( EntityManager* em, Vector< EntityHandle >& created )
+	{
+		EntityCommandBuffer* buffer = em->GetCommandBuffer( );
+
+		EntityHandle captured;
+		DeferredEntity deferred = buffer->CreateEntity( );
+		buffer->AddComponent< PointLightComponent >( deferred, CaptureEntity( &captured ) );
+		buffer->AddComponent< StaticMeshComponent >( deferred );
+
+		// Nothing happens while recording
+		bool recorded = buffer->GetCommandCount( ) == 3 && !captured;
+
+		em->PlaybackCommandBuffers( );
+		created.push_back( captured );
+
+		bool played = buffer->GetCommandCount( ) == 0
+						&& IsAlive( captured )
+						&& captured.Get( )->HasComponent< PointLightComponent >( )
+						&& captured.Get( )->HasComponent< StaticMeshComponent >( );
+
+		return CheckCase( "DeferredCreate", recorded && played );
+	}
+
+	//==================================================================================
+
+	INTERNAL bool TestAddRemoveOrder( EntityManager* em, Vector< EntityHandle >& created )
+	{
+		EntityHandle entity = em->Allocate( );
+		created.push_back( entity );
+
+		// Add then remove leaves nothing, remove then add leaves the component
+		EntityCommandBuffer* buffer = em->GetCommandBuffer( );
+		buffer->AddComponent< PointLightComponent >( entity );
+		buffer->RemoveComponent< PointLightComponent >( entity );
+		buffer->RemoveComponent< StaticMeshComponent >( entity );
+		buffer->AddComponent< StaticMeshComponent >( entity );
+
+		bool recorded = !entity.Get( )->HasComponent< PointLightComponent >( ) && !entity.Get( )->HasComponent< StaticMeshComponent >( );
+
+		em->PlaybackCommandBuffers( );
+
+		bool played = !entity.Get( )->HasComponent< PointLightComponent >( ) && entity.Get( )->HasComponent< StaticMeshComponent >( );
+
+		return CheckCase( "AddRemoveOrder", recorded && played );
+	}
+
+	//==================================================================================
+
+	INTERNAL bool TestSortKeyOrder( EntityManager* em, Vector< EntityHandle >& created )
+	{
+		EntityHandle entity = em->Allocate( );
+		created.push_back( entity );
+
+		// Recorded remove before add, but the add has the lower key so plays back first and the remove wins
+		EntityCommandBuffer* buffer = em->GetCommandBuffer( );
+		buffer->SetSortKey( 1 );
+		buffer->RemoveComponent< PointLightComponent >( entity );
+		buffer->SetSortKey( 0 );
+		buffer->AddComponent< PointLightComponent >( entity );
+
+		em->PlaybackCommandBuffers( );
+
+		return CheckCase( "SortKeyOrder", !entity.Get( )->HasComponent< PointLightComponent >( ) );
+	}
+
+	//==================================================================================
+
+	INTERNAL bool TestDestroyExisting( EntityManager* em )
+	{
+		EntityHandle entity = em->Allocate( );
+		em->ForceAddEntities( );
+
+		bool applied = false;
+		EntityCommandBuffer* buffer = em->GetCommandBuffer( );
+		buffer->DestroyEntity( entity );
+		buffer->AddComponent< PointLightComponent >( entity, [ &applied ]( PointLightComponent* c )
+		{
+			applied = true;
+		} );
+
+		bool recorded = IsAlive( entity );
+
+		em->PlaybackCommandBuffers( );
+
+		// Destroyed at playback, gone once cleaned up, and nothing after the destroy touched it
+		bool played = !IsAlive( entity ) && !applied;
+		em->ForceCleanup( );
+
+		return CheckCase( "DestroyExisting", recorded && played && !entity.Get( ) );
+	}
+
+	//==================================================================================
+
+	INTERNAL bool TestDestroyDeferred( EntityManager* em )
+	{
+		EntityHandle captured;
+		bool applied = false;
+
+		EntityCommandBuffer* buffer = em->GetCommandBuffer( );
+		DeferredEntity deferred = buffer->CreateEntity( );
+		buffer->AddComponent< PointLightComponent >( deferred, CaptureEntity( &captured ) );
+		buffer->DestroyEntity( deferred );
+		buffer->AddComponent< StaticMeshComponent >( deferred, [ &applied ]( StaticMeshComponent* c )
+		{
+			applied = true;
+		} );
+
+		em->PlaybackCommandBuffers( );
+
+		bool played = captured.Get( ) && !IsAlive( captured ) && !applied;
+
+		em->ForceAddEntities( );
+		em->ForceCleanup( );
+
+		return CheckCase( "DestroyDeferred", played && !captured.Get( ) );
+	}
+
+	//==================================================================================
+
+	INTERNAL bool TestStaleHandle( EntityManager* em )
+	{
+		EntityHandle entity = em->Allocate( );
+		em->ForceAddEntities( );
+
+		bool applied = false;
+		EntityCommandBuffer* buffer = em->GetCommandBuffer( );
+		buffer->AddComponent< PointLightComponent >( entity, [ &applied ]( PointLightComponent* c )
+		{
+			applied = true;
+		} );
+
+		// Entity goes away between recording and playback, and its id may be reused by the next allocation
+		entity.Get( )->Destroy( );
+		em->ForceCleanup( );
+		EntityHandle reused = em->Allocate( );
+
+		em->PlaybackCommandBuffers( );
+
+		bool passed = !applied && !reused.Get( )->HasComponent< PointLightComponent >( );
+
+		reused.Get( )->Destroy( );
+		em->ForceAddEntities( );
+		em->ForceCleanup( );
+
+		return CheckCase( "StaleHandle", passed );
+	}
+
+	//==================================================================================
+
+	bool RunEntityCommandBufferTest( )
+	{
+		EntityManager* em = EngineSubsystem( EntityManager );
+
+		// Nothing left over from startup
+		em->PlaybackCommandBuffers( );
+
+		std::cout << "Entity command buffer:\n";
+
+		Vector< EntityHandle > created;
+		bool passed = true;
+		passed &= TestDeferredCreate( em, created );
+		passed &= TestAddRemoveOrder( em, created );
+		passed &= TestSortKeyOrder( em, created );
+		passed &= TestDestroyExisting( em );
+		passed &= TestDestroyDeferred( em );
+		passed &= TestStaleHandle( em );
+
+		em->ForceAddEntities( );
+		for ( auto& e : created )
+		{
+			if ( e )
+			{
+				e.Get( )->Destroy( );
+			}
+		}
+		em->ForceCleanup( );
+
+		std::cout << ( passed ? "All cases passed\n" : "Some cases FAILED\n" );
+
+		return passed;
+	}
+
+	//==================================================================================
+}
@@ -0,0 +1,439 @@
+// @file MathDifferentialTest.cpp
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#include "MathDifferentialTest.h"
+
+#include <Math/Bounds.h>
+#include <Math/Frustum.h>
+#include <Math/Simd.h>
+#include <Math/Transform.h>
+#include <Math/TransformStream.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+namespace Enjon
+{
+	// Largest relative difference allowed between kernels
+	INTERNAL const f32 gMathTolerance = 1e-5f;
+
+	//==================================================================================
+
+	/**
+	* @brief Tracks largest difference between expected and actual results of one kernel
+	*/
+	class DifferentialCheck
+	{
+		public:
+
+			/**
+			* @brief
+			*/
+			DifferentialCheck( const char* name )
+				: mName( name )
+			{
+			}
+
+			/**
+			* @brief
+			*/
+			void Compare( const f32* expected, const f32* actual, const u32& count )
+			{
+				for ( u32 i = 0; i < count; ++i )
+				{
+					f32 error = std::fabs( expected[ i ] - actual[ i ] ) / std::max( 1.0f, std::fabs( expected[ i ] ) );
+					mMaxError = std::max( mMaxError, error );
+					if ( !( error <= gMathTolerance ) )
+					{
+						mFailures++;
+					}
+				}
+			}
+
+			/**
+			* @brief Prints result and returns whether all compared values matched
+			*/
+			bool Report( ) const
+			{
+				std::cout << "\t" << mName << ": " << ( mFailures ? "FAILED" : "ok" ) << " ( max relative error " << mMaxError << ", " << mFailures << " mismatches )\n";
+				return mFailures == 0;
+			}
+
+		private:
+			const char* mName = nullptr;
+			f32 mMaxError = 0.0f;
+			u32 mFailures = 0;
+	};
+
+	//==================================================================================
+
+	INTERNAL std::mt19937 gMathRandom( 1337 );
+
+	INTERNAL void RandomFloats( f32* out, const u32& count, const f32& min = -10.0f, const f32& max = 10.0f )
+	{
+		std::uniform_real_distribution< f32 > dist( min, max );
+		for ( u32 i = 0; i < count; ++i )
+		{
+			out[ i ] = dist( gMathRandom );
+		}
+	}
+
+	INTERNAL Quaternion RandomRotation( )
+	{
+		Quaternion q;
+		RandomFloats( &q.x, 4, -1.0f, 1.0f );
+		return q.Normalize( );
+	}
+
+	//==================================================================================
+
+	// Transform::operator* composed from the scalar reference kernels
+	INTERNAL void ScalarTransformMultiply( const Transform& lhs, const Transform& rhs, f32* outPosition, f32* outRotation, f32* outScale )
+	{
+		Quaternion lhsRot = lhs.GetRotation( );
+		Quaternion rhsRot = rhs.GetRotation( );
+		Vec3 lhsPos = lhs.GetPosition( ), lhsScale = lhs.GetScale( );
+		Vec3 rhsPos = rhs.GetPosition( ), rhsScale = rhs.GetScale( );
+
+		f32 rhsRotNorm[ 4 ], rotNorm[ 4 ], rot[ 4 ];
+		Simd::Scalar::Normalize4( &rhsRot.x, rhsRotNorm );
+		Simd::Scalar::Normalize4( &lhsRot.x, rotNorm );
+		Simd::Scalar::QuatMultiply( rhsRotNorm, rotNorm, rot );
+		Simd::Scalar::Normalize4( rot, outRotation );
+
+		Vec3 scaledPos = rhsScale * lhsPos;
+		f32 rotated[ 3 ];
+		Simd::Scalar::QuatRotate( rhsRotNorm, &scaledPos.x, rotated );
+
+		Vec3 scale = rhsScale * lhsScale;
+		for ( u32 i = 0; i < 3; ++i )
+		{
+			outPosition[ i ] = ( &rhsPos.x )[ i ] + rotated[ i ];
+			outScale[ i ] = ( &scale.x )[ i ];
+		}
+	}
+
+	//==================================================================================
+
+	INTERNAL bool RunKernelChecks( const u32& caseCount )
+	{
+		bool passed = true;
+
+#if ENJON_MATH_SSE
+		DifferentialCheck dot( "Dot4" ), add( "Add4" ), subtract( "Subtract4" ), multiply( "Multiply4" ), divide( "Divide4" ), normalize( "Normalize4" );
+		DifferentialCheck quatMultiply( "QuatMultiply" ), quatRotate( "QuatRotate" ), blend( "Blend4" );
+		DifferentialCheck matVec( "Mat4MultiplyVec4" ), matPoint( "Mat4MultiplyPoint" ), matMat( "Mat4Multiply" );
+
+		for ( u32 c = 0; c < caseCount; ++c )
+		{
+			f32 a[ 16 ], b[ 16 ], expected[ 16 ], actual[ 16 ];
+			RandomFloats( a, 16 );
+			RandomFloats( b, 16 );
+
+			f32 expectedDot = Simd::Scalar::Dot4( a, b );
+			f32 actualDot = Simd::SSE::Dot4( a, b );
+			dot.Compare( &expectedDot, &actualDot, 1 );
+
+			Simd::Scalar::Add4( a, b, expected ); Simd::SSE::Add4( a, b, actual ); add.Compare( expected, actual, 4 );
+			Simd::Scalar::Subtract4( a, b, expected ); Simd::SSE::Subtract4( a, b, actual ); subtract.Compare( expected, actual, 4 );
+			Simd::Scalar::Multiply4( a, b, expected ); Simd::SSE::Multiply4( a, b, actual ); multiply.Compare( expected, actual, 4 );
+
+			// Keep divisors away from zero
+			f32 divisor[ 4 ];
+			RandomFloats( divisor, 4, 0.5f, 2.0f );
+			Simd::Scalar::Divide4( a, divisor, expected ); Simd::SSE::Divide4( a, divisor, actual ); divide.Compare( expected, actual, 4 );
+
+			Simd::Scalar::Normalize4( a, expected ); Simd::SSE::Normalize4( a, actual ); normalize.Compare( expected, actual, 4 );
+
+			Simd::Scalar::QuatMultiply( a, b, expected ); Simd::SSE::QuatMultiply( a, b, actual ); quatMultiply.Compare( expected, actual, 4 );
+			Simd::Scalar::QuatRotate( a, b, expected ); Simd::SSE::QuatRotate( a, b, actual ); quatRotate.Compare( expected, actual, 3 );
+
+			f32 t = b[ 15 ] / 10.0f;
+			Simd::Scalar::Blend4( a, 1.0f - t, b, t, expected ); Simd::SSE::Blend4( a, 1.0f - t, b, t, actual ); blend.Compare( expected, actual, 4 );
+
+			Simd::Scalar::Mat4MultiplyVec4( a, b, expected ); Simd::SSE::Mat4MultiplyVec4( a, b, actual ); matVec.Compare( expected, actual, 4 );
+			Simd::Scalar::Mat4MultiplyPoint( a, b, expected ); Simd::SSE::Mat4MultiplyPoint( a, b, actual ); matPoint.Compare( expected, actual, 3 );
+			Simd::Scalar::Mat4Multiply( a, b, expected ); Simd::SSE::Mat4Multiply( a, b, actual ); matMat.Compare( expected, actual, 16 );
+
+			// Output aliasing an input, as Mat4x4::Multiply( ) does
+			for ( u32 i = 0; i < 16; ++i ) actual[ i ] = a[ i ];
+			Simd::SSE::Mat4Multiply( actual, b, actual );
+			matMat.Compare( expected, actual, 16 );
+		}
+
+		for ( auto check : { &dot, &add, &subtract, &multiply, &divide, &normalize, &quatMultiply, &quatRotate, &blend, &matVec, &matPoint, &matMat } )
+		{
+			passed &= check->Report( );
+		}
+#else
+		std::cout << "\tBuilt with ENJON_MATH_SCALAR, only the scalar kernels exist\n";
+#endif
+
+		return passed;
+	}
+
+	//==================================================================================
+
+	INTERNAL bool RunClassChecks( const u32& caseCount )
+	{
+		DifferentialCheck quatMultiply( "Quaternion::operator*" ), quatNormalize( "Quaternion::Normalize" ), quatRotate( "Quaternion::operator*( Vec3 )" );
+		DifferentialCheck matMultiply( "Mat4x4::operator*" ), transformMultiply( "Transform::operator*" );
+
+		for ( u32 c = 0; c < caseCount; ++c )
+		{
+			f32 expected[ 16 ];
+
+			Quaternion qa, qb;
+			RandomFloats( &qa.x, 4 );
+			RandomFloats( &qb.x, 4 );
+
+			Quaternion q = qa * qb;
+			Simd::Scalar::QuatMultiply( &qa.x, &qb.x, expected );
+			quatMultiply.Compare( expected, &q.x, 4 );
+
+			q = qa.Normalize( );
+			Simd::Scalar::Normalize4( &qa.x, expected );
+			quatNormalize.Compare( expected, &q.x, 4 );
+
+			Vec3 v;
+			RandomFloats( &v.x, 3 );
+			Vec3 rotated = qa * v;
+			Simd::Scalar::QuatRotate( &qa.x, &v.x, expected );
+			quatRotate.Compare( expected, &rotated.x, 3 );
+
+			Mat4x4 ma, mb;
+			RandomFloats( ma.elements, 16 );
+			RandomFloats( mb.elements, 16 );
+			Mat4x4 m = ma * mb;
+			Simd::Scalar::Mat4Multiply( ma.elements, mb.elements, expected );
+			matMultiply.Compare( expected, m.elements, 16 );
+
+			Vec3 pa, pb, sa, sb;
+			RandomFloats( &pa.x, 3 );
+			RandomFloats( &pb.x, 3 );
+			RandomFloats( &sa.x, 3, 0.5f, 2.0f );
+			RandomFloats( &sb.x, 3, 0.5f, 2.0f );
+			Transform ta( pa, RandomRotation( ), sa );
+			Transform tb( pb, RandomRotation( ), sb );
+
+			Transform t = ta * tb;
+			Vec3 position = t.GetPosition( ), scale = t.GetScale( );
+			Quaternion rotation = t.GetRotation( );
+
+			ScalarTransformMultiply( ta, tb, expected, expected + 4, expected + 8 );
+			transformMultiply.Compare( expected, &position.x, 3 );
+			transformMultiply.Compare( expected + 4, &rotation.x, 4 );
+			transformMultiply.Compare( expected + 8, &scale.x, 3 );
+		}
+
+		bool passed = true;
+		for ( auto check : { &quatMultiply, &quatNormalize, &quatRotate, &matMultiply, &transformMultiply } )
+		{
+			passed &= check->Report( );
+		}
+
+		return passed;
+	}
+
+	//==================================================================================
+
+	// Checks every stream kernel against the Transform it replaces, over a count that isn't a multiple of four so the scalar tail is used too
+	INTERNAL bool RunStreamChecks( const u32& caseCount )
+	{
+		DifferentialCheck compose( "TransformStream::Compose" ), inverseCompose( "TransformStream::InverseCompose" );
+		DifferentialCheck toMatrices( "TransformStream::ToMatrices" ), transformPoints( "TransformStream::TransformPoints" );
+
+		u32 count = caseCount | 3;
+		Vector< Transform > locals, parents;
+		Vector< Vec3 > points( count ), transformedPoints( count );
+		Vector< Mat4x4 > matrices( count );
+		TransformStream localStream( count ), parentStream( count ), outStream( count );
+
+		for ( u32 i = 0; i < count; ++i )
+		{
+			Vec3 position, scale;
+			RandomFloats( &position.x, 3 );
+			RandomFloats( &scale.x, 3, 0.5f, 2.0f );
+			locals.push_back( Transform( position, RandomRotation( ), scale ) );
+
+			RandomFloats( &position.x, 3 );
+			RandomFloats( &scale.x, 3, 0.5f, 2.0f );
+			parents.push_back( Transform( position, RandomRotation( ), scale ) );
+
+			RandomFloats( &points[ i ].x, 3 );
+
+			localStream.Set( i, locals[ i ] );
+			parentStream.Set( i, parents[ i ] );
+		}
+
+		auto compareTransforms = [ & ]( DifferentialCheck& check, const Transform& expected, const Transform& actual )
+		{
+			Vec3 ep = expected.GetPosition( ), ap = actual.GetPosition( ), es = expected.GetScale( ), as = actual.GetScale( );
+			Quaternion er = expected.GetRotation( ), ar = actual.GetRotation( );
+			check.Compare( &ep.x, &ap.x, 3 );
+			check.Compare( &er.x, &ar.x, 4 );
+			check.Compare( &es.x, &as.x, 3 );
+		};
+
+		TransformStream::Compose( localStream, parentStream, outStream, 0, count );
+		for ( u32 i = 0; i < count; ++i )
+		{
+			compareTransforms( compose, locals[ i ] * parents[ i ], outStream.Get( i ) );
+		}
+
+		TransformStream::InverseCompose( localStream, parentStream, outStream, 0, count );
+		for ( u32 i = 0; i < count; ++i )
+		{
+			compareTransforms( inverseCompose, locals[ i ] / parents[ i ], outStream.Get( i ) );
+		}
+
+		TransformStream::ToMatrices( localStream, matrices.data( ), 0, count );
+		TransformStream::TransformPoints( localStream, points.data( ), transformedPoints.data( ), 0, count );
+		for ( u32 i = 0; i < count; ++i )
+		{
+			Mat4x4 expected = locals[ i ].ToMat4x4( );
+			toMatrices.Compare( expected.elements, matrices[ i ].elements, 16 );
+
+			Vec3 expectedPoint = expected * points[ i ];
+			transformPoints.Compare( &expectedPoint.x, &transformedPoints[ i ].x, 3 );
+		}
+
+		bool passed = true;
+		for ( auto check : { &compose, &inverseCompose, &toMatrices, &transformPoints } )
+		{
+			passed &= check->Report( );
+		}
+
+		return passed;
+	}
+
+	//==================================================================================
+
+	// Bounds around a sphere, which is how culling sees them
+	INTERNAL Bounds SphereBounds( const Vec3& center, const f32& radius )
+	{
+		return Bounds( center - Vec3( radius ), center + Vec3( radius ) );
+	}
+
+	//==================================================================================
+
+	// Known inside / outside cases against a 90 degree camera at the origin looking down -z, where the side planes are
+	// x = ±z and y = ±z, then the SSE culling path against the scalar one for random frustums and boxes
+	INTERNAL bool RunCullingChecks( const u32& caseCount )
+	{
+		DifferentialCheck frustumCases( "Frustum known cases" ), boundsCases( "Bounds::TransformedBy" ), cull( "Frustum::CullBounds" );
+
+		Mat4x4 viewProjection = Mat4x4::Perspective( 90.0f, 1.0f, 0.1f, 100.0f ) * Mat4x4::LookAt( Vec3( 0.0f ), Vec3( 0.0f, 0.0f, -1.0f ), Vec3( 0.0f, 1.0f, 0.0f ) );
+		Frustum frustum( viewProjection );
+
+		struct CullingCase
+		{
+			Bounds mBounds;
+			bool mVisible;
+		};
+
+		CullingCase cases[ ] =
+		{
+			{ Bounds( Vec3( -1.0f, -1.0f, -11.0f ), Vec3( 1.0f, 1.0f, -9.0f ) ), true },		// Box in front
+			{ Bounds( Vec3( -1.0f, -1.0f, 9.0f ), Vec3( 1.0f, 1.0f, 11.0f ) ), false },			// Box behind
+			{ Bounds( Vec3( -1.0f, -1.0f, -151.0f ), Vec3( 1.0f, 1.0f, -149.0f ) ), false },	// Box past far plane
+			{ Bounds( Vec3( -1.0f, -1.0f, -1.0f ), Vec3( 1.0f, 1.0f, 1.0f ) ), true },			// Box around near plane
+			{ Bounds( Vec3( -11.0f, -1.0f, -11.0f ), Vec3( -9.0f, 1.0f, -9.0f ) ), true },		// Box across left plane
+			{ Bounds( Vec3( -14.0f, -1.0f, -11.0f ), Vec3( -12.0f, 1.0f, -9.0f ) ), false },	// Box outside left plane
+			{ Bounds( Vec3( 12.0f, -1.0f, -11.0f ), Vec3( 14.0f, 1.0f, -9.0f ) ), false },		// Box outside right plane
+			{ SphereBounds( Vec3( 0.0f, 0.0f, -50.0f ), 5.0f ), true },							// Sphere inside
+			{ SphereBounds( Vec3( 0.0f, 50.0f, -50.0f ), 5.0f ), true },						// Sphere across top plane
+			{ SphereBounds( Vec3( 0.0f, 70.0f, -50.0f ), 5.0f ), false },						// Sphere above top plane
+			{ SphereBounds( Vec3( 0.0f, -70.0f, -50.0f ), 5.0f ), false },						// Sphere below bottom plane
+			{ SphereBounds( Vec3( 0.0f, 0.0f, -98.0f ), 5.0f ), true },							// Sphere across far plane
+			{ Bounds( ), true }																	// Invalid bounds are never culled
+		};
+
+		for ( auto& c : cases )
+		{
+			f32 expected = c.mVisible ? 1.0f : 0.0f;
+			f32 actual = frustum.Intersects( c.mBounds ) ? 1.0f : 0.0f;
+			frustumCases.Compare( &expected, &actual, 1 );
+		}
+
+		// Default frustum contains everything
+		f32 one = 1.0f;
+		f32 containsAll = Frustum( ).Intersects( SphereBounds( Vec3( 1e6f ), 1.0f ) ) ? 1.0f : 0.0f;
+		frustumCases.Compare( &one, &containsAll, 1 );
+
+		// Unit box turned 45 degrees about y and moved, extents along x and z grow to sqrt( 2 )
+		Bounds turned = Bounds( Vec3( -1.0f ), Vec3( 1.0f ) ).TransformedBy( Mat4x4::Translate( Vec3( 5.0f, 0.0f, 0.0f ) ) * Mat4x4::Rotate( 45.0f, Vec3( 0.0f, 1.0f, 0.0f ) ) );
+		Vec3 center = turned.GetCenter( ), extents = turned.GetExtents( );
+		f32 expectedCenter[ 3 ] = { 5.0f, 0.0f, 0.0f };
+		f32 expectedExtents[ 3 ] = { std::sqrt( 2.0f ), 1.0f, std::sqrt( 2.0f ) };
+		boundsCases.Compare( expectedCenter, &center.x, 3 );
+		boundsCases.Compare( expectedExtents, &extents.x, 3 );
+
+		// Count that isn't a multiple of four, culled from an unaligned start as well so both SSE blocks and the scalar tail are used
+		u32 count = caseCount | 3;
+		Vector< Bounds > bounds( count );
+		BoundsStream stream;
+		stream.Resize( count );
+		for ( u32 i = 0; i < count; ++i )
+		{
+			Vec3 boxCenter, boxExtents;
+			RandomFloats( &boxCenter.x, 3, -50.0f, 50.0f );
+			RandomFloats( &boxExtents.x, 3, 0.1f, 5.0f );
+			bounds[ i ] = Bounds( boxCenter - boxExtents, boxCenter + boxExtents );
+			stream.Set( i, bounds[ i ] );
+		}
+
+		Vector< u8 > visible( count );
+		for ( u32 f = 0; f < 8; ++f )
+		{
+			Vec3 position, target;
+			RandomFloats( &position.x, 3, -20.0f, 20.0f );
+			RandomFloats( &target.x, 3, -20.0f, 20.0f );
+			Frustum randomFrustum( Mat4x4::Perspective( 60.0f, 16.0f / 9.0f, 0.1f, 60.0f ) * Mat4x4::LookAt( position, target, Vec3( 0.0f, 1.0f, 0.0f ) ) );
+
+			u32 begin = f % 2;
+			randomFrustum.CullBounds( stream, begin, count, visible.data( ) );
+			for ( u32 i = begin; i < count; ++i )
+			{
+				f32 expected = randomFrustum.Intersects( bounds[ i ] ) ? 1.0f : 0.0f;
+				f32 actual = visible[ i ] ? 1.0f : 0.0f;
+				cull.Compare( &expected, &actual, 1 );
+			}
+		}
+
+		bool passed = true;
+		for ( auto check : { &frustumCases, &boundsCases, &cull } )
+		{
+			passed &= check->Report( );
+		}
+
+		return passed;
+	}
+
+	//==================================================================================
+
+	bool RunMathDifferentialTest( const u32& caseCount )
+	{
+		std::cout << "Math differential test: " << caseCount << " cases, " << ( ENJON_MATH_SSE ? "SSE" : "scalar" ) << " build\n";
+
+		std::cout << "Kernels ( SSE against scalar ):\n";
+		bool passed = RunKernelChecks( caseCount );
+
+		std::cout << "Math classes ( against scalar kernels ):\n";
+		passed &= RunClassChecks( caseCount );
+
+		std::cout << "Transform streams ( against Transform ):\n";
+		passed &= RunStreamChecks( caseCount );
+
+		std::cout << "Culling ( against known cases and scalar path ):\n";
+		passed &= RunCullingChecks( caseCount );
+
+		std::cout << ( passed ? "All math results match the scalar path\n" : "Math results differ from the scalar path\n" );
+
+		return passed;
+	}
+
+	//==================================================================================
+}
@@ -0,0 +1,237 @@
+// @file RenderQueueTest.cpp
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#include "RenderQueueTest.h"
+
+#include <Graphics/RenderQueue.h>
+#include <Graphics/ShaderGraph.h>
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+
+namespace Enjon
+{
+	// Distinct shaders, materials and submeshes the queue orders before later ones start sharing its last slot
+	INTERNAL const u32 gShaderCapacity		= 1u << 12;
+	INTERNAL const u32 gMaterialCapacity	= 1u << 16;
+	INTERNAL const u32 gSubMeshCapacity		= 1u << 16;
+
+	// Depths are drawn from this grid, coarse enough that the queue's depth precision never merges two of them
+	INTERNAL const u32 gDepthSteps			= 1024;
+
+	INTERNAL std::mt19937 gRenderQueueRandom( 1337 );
+
+	//==================================================================================
+
+	/**
+	* @brief Distinct addresses standing in for shaders, materials and submeshes. The queue only ever compares them.
+	*/
+	class FakeObjects
+	{
+		public:
+
+			/**
+			* @brief
+			*/
+			FakeObjects( const u32& count )
+				: mObjects( count )
+			{
+			}
+
+			/**
+			* @brief
+			*/
+			template < typename T >
+			const T* Get( const u32& index ) const
+			{
+				return reinterpret_cast< const T* >( &mObjects[ index ] );
+			}
+
+		private:
+			Vector< u64 > mObjects;
+	};
+
+	//==================================================================================
+
+	struct RenderQueueInput
+	{
+		ShaderPassType mPass;
+		u32 mShader;
+		u32 mMaterial;
+		u32 mSubMesh;
+		f32 mDepth;
+	};
+
+	//==================================================================================
+
+	INTERNAL bool ReportCheck( const char* name, const u32& mismatches )
+	{
+		std::cout << "\t" << name << ": " << ( mismatches ? "FAILED" : "ok" ) << " ( " << mismatches << " mismatches )\n";
+		return mismatches == 0;
+	}
+
+	//==================================================================================
+
+	// Position of each object in the order it's first pushed, objects past capacity all share the last position
+	INTERNAL Vector< u32 > FirstSeenRanks( const Vector< RenderQueueInput >& inputs, u32 RenderQueueInput::* field, const u32& objectCount, const u32& capacity )
+	{
+		Vector< u32 > ranks( objectCount, 0 );
+		Vector< u8 > seen( objectCount, 0 );
+		u32 next = 0;
+		for ( auto& in : inputs )
+		{
+			u32 object = in.*field;
+			if ( !seen[ object ] )
+			{
+				seen[ object ] = 1;
+				ranks[ object ] = std::min( next++, capacity - 1 );
+			}
+		}
+
+		return ranks;
+	}
+
+	//==================================================================================
+
+	// Pushes inputs in order, sorts the queue and returns the number of commands placed differently than std::stable_sort
+	// of the push order by pass, then shader, material, submesh and depth. Each command is tagged with its push index.
+	INTERNAL u32 SortAndCompare( const Vector< RenderQueueInput >& inputs, const u32& objectCount )
+	{
+		FakeObjects objects( objectCount );
+		RenderQueue queue;
+		for ( u32 i = 0; i < inputs.size( ); ++i )
+		{
+			const RenderQueueInput& in = inputs[ i ];
+			queue.Push( in.mPass, objects.Get< Shader >( in.mShader ), objects.Get< Material >( in.mMaterial ), objects.Get< SubMesh >( in.mSubMesh ), nullptr, i, in.mDepth );
+		}
+
+		Vector< u32 > shaders = FirstSeenRanks( inputs, &RenderQueueInput::mShader, objectCount, gShaderCapacity );
+		Vector< u32 > materials = FirstSeenRanks( inputs, &RenderQueueInput::mMaterial, objectCount, gMaterialCapacity );
+		Vector< u32 > subMeshes = FirstSeenRanks( inputs, &RenderQueueInput::mSubMesh, objectCount, gSubMeshCapacity );
+
+		Vector< u32 > expected( inputs.size( ) );
+		for ( u32 i = 0; i < expected.size( ); ++i )
+		{
+			expected[ i ] = i;
+		}
+
+		std::stable_sort( expected.begin( ), expected.end( ), [ & ]( const u32& a, const u32& b )
+		{
+			const RenderQueueInput& l = inputs[ a ];
+			const RenderQueueInput& r = inputs[ b ];
+			if ( l.mPass != r.mPass ) return ( u32 )l.mPass < ( u32 )r.mPass;
+			if ( shaders[ l.mShader ] != shaders[ r.mShader ] ) return shaders[ l.mShader ] < shaders[ r.mShader ];
+			if ( materials[ l.mMaterial ] != materials[ r.mMaterial ] ) return materials[ l.mMaterial ] < materials[ r.mMaterial ];
+			if ( subMeshes[ l.mSubMesh ] != subMeshes[ r.mSubMesh ] ) return subMeshes[ l.mSubMesh ] < subMeshes[ r.mSubMesh ];
+			return std::max( 0.0f, std::min( l.mDepth, 1.0f ) ) < std::max( 0.0f, std::min( r.mDepth, 1.0f ) );
+		} );
+
+		queue.Sort( );
+
+		u32 mismatches = queue.GetCount( ) == inputs.size( ) ? 0 : 1;
+		for ( u32 i = 0; i < queue.GetCount( ) && i < expected.size( ); ++i )
+		{
+			mismatches += queue.GetCommand( i ).mSubMeshIndex == expected[ i ] ? 0 : 1;
+		}
+
+		return mismatches;
+	}
+
+	//==================================================================================
+
+	INTERNAL RenderQueueInput RandomInput( const u32& shaderCount, const u32& materialCount, const u32& subMeshCount )
+	{
+		// Grid steps past either end check that depth is clamped rather than wrapped
+		std::uniform_int_distribution< s32 > depth( -( s32 )gDepthSteps / 4, ( s32 )gDepthSteps + ( s32 )gDepthSteps / 4 );
+
+		RenderQueueInput in;
+		in.mPass = ( ShaderPassType )( gRenderQueueRandom( ) % ( u32 )ShaderPassType::Count );
+		in.mShader = gRenderQueueRandom( ) % shaderCount;
+		in.mMaterial = gRenderQueueRandom( ) % materialCount;
+		in.mSubMesh = gRenderQueueRandom( ) % subMeshCount;
+		in.mDepth = ( f32 )depth( gRenderQueueRandom ) / ( f32 )gDepthSteps;
+		return in;
+	}
+
+	//==================================================================================
+
+	// Random commands over few and many distinct objects, and sizes where most or all fields are uniform
+	INTERNAL bool RunSortChecks( const u32& commandCount )
+	{
+		struct SortCase
+		{
+			u32 mCount;
+			u32 mShaders;
+			u32 mMaterials;
+			u32 mSubMeshes;
+		};
+
+		SortCase cases[ ] =
+		{
+			{ commandCount, 8, 64, 512 },
+			{ commandCount, 2000, 20000, 20000 },
+			{ commandCount, 1, 1, 1 },
+			{ 3, 2, 2, 2 },
+			{ 1, 1, 1, 1 },
+			{ 0, 1, 1, 1 }
+		};
+
+		u32 mismatches = 0;
+		for ( auto& c : cases )
+		{
+			Vector< RenderQueueInput > inputs;
+			for ( u32 i = 0; i < c.mCount; ++i )
+			{
+				inputs.push_back( RandomInput( c.mShaders, c.mMaterials, c.mSubMeshes ) );
+			}
+
+			mismatches += SortAndCompare( inputs, 20000 );
+		}
+
+		return ReportCheck( "Pass, shader, material, submesh, depth order", mismatches );
+	}
+
+	//==================================================================================
+
+	// More distinct objects in one field than the queue can order, spread over every pass and mixed with a few objects
+	// in the other fields. Objects past capacity must sort as one object after all others in their pass, without
+	// disturbing the order of passes or of the fields around them.
+	INTERNAL bool RunClampCheck( const char* name, u32 RenderQueueInput::* field, const u32& capacity )
+	{
+		u32 objectCount = capacity + 100;
+
+		Vector< RenderQueueInput > inputs;
+		for ( u32 o = 0; o < objectCount; ++o )
+		{
+			for ( u32 i = 0; i < 2; ++i )
+			{
+				RenderQueueInput in = RandomInput( 3, 3, 3 );
+				in.*field = o;
+				inputs.push_back( in );
+			}
+		}
+
+		std::shuffle( inputs.begin( ), inputs.end( ), gRenderQueueRandom );
+
+		return ReportCheck( name, SortAndCompare( inputs, objectCount ) );
+	}
+
+	//==================================================================================
+
+	bool RunRenderQueueTest( const u32& commandCount )
+	{
+		std::cout << "Render queue test: " << commandCount << " commands\n";
+
+		bool passed = RunSortChecks( commandCount );
+		passed &= RunClampCheck( "Shaders past capacity", &RenderQueueInput::mShader, gShaderCapacity );
+		passed &= RunClampCheck( "Materials past capacity", &RenderQueueInput::mMaterial, gMaterialCapacity );
+		passed &= RunClampCheck( "Submeshes past capacity", &RenderQueueInput::mSubMesh, gSubMeshCapacity );
+
+		std::cout << ( passed ? "All render queue checks passed\n" : "Some render queue checks FAILED\n" );
+
+		return passed;
+	}
+
+	//==================================================================================
+}
@@ -2,6 +2,10 @@
 // Copyright 2016-2018 John Jackson. All Rights Reserved.
 
 #include <Enjon.h>
+#include "EntityCommandBufferTest.h"
+#include "EngineHarness.h"
+#include "MathDifferentialTest.h"
+#include "RenderQueueTest.h"
  
 #include <filesystem> 
 #include <iostream> 
@@ -43,6 +47,31 @@ String Vec3ToString( const glm::vec3& v )
 #endif
 int main(int argc, char** argv)
 { 
+	// Entity command buffer playback: --command-buffer-test
+	if ( argc > 1 && String( argv[ 1 ] ) == "--command-buffer-test" )
+	{
+		Result res = RunWithEngine( [ ]( )
+		{
+			return RunEntityCommandBufferTest( ) ? Result::SUCCESS : Result::FAILURE;
+		} );
+
+		return res == Result::SUCCESS ? 0 : 1;
+	}
+
+	// SIMD math against scalar reference: --math-differential [case count]
+	if ( argc > 1 && String( argv[ 1 ] ) == "--math-differential" )
+	{
+		u32 caseCount = argc > 2 ? ( u32 )std::stoul( argv[ 2 ] ) : 10000;
+		return RunMathDifferentialTest( caseCount ) ? 0 : 1;
+	}
+
+	// Render queue keys and sort against std::stable_sort: --render-queue-test [command count]
+	if ( argc > 1 && String( argv[ 1 ] ) == "--render-queue-test" )
+	{
+		u32 commandCount = argc > 2 ? ( u32 )std::stoul( argv[ 2 ] ) : 10000;
+		return RunRenderQueueTest( commandCount ) ? 0 : 1;
+	}
+
 	// Not sure how to set this up, so fuck it
 	Quaternion q1 = Quaternion::AngleAxis( Math::ToRadians( 90.0f ), Vec3::YAxis( ) ) * Quaternion::AngleAxis( Math::ToRadians( 40.0f ), Vec3::ZAxis( ) ) * Quaternion::AngleAxis( Math::ToRadians( -10.0f ), Vec3::XAxis( ) );
 	glm::quat q2 = glm::angleAxis( Math::ToRadians( 90.0f ), glm::vec3( 0.0f, 1.0f, 0.0f ) ) * glm::angleAxis( Math::ToRadians( 40.0f ), glm::vec3( 0.0f, 0.0f, 1.0f ) ) * glm::angleAxis( Math::ToRadians( -10.0f ), glm::vec3( 1.0f, 0.0f, 0.0f ) );
@@ -360,7 +360,7 @@ namespace Enjon
 				return ( mAssetsByName.find( name ) != mAssetsByName.end( ) );
 			} 
 
-			const HashMap< String, AssetRecordInfo >* GetAssets( ) const
+			const HashMap< UUID, AssetRecordInfo >* GetAssets( ) const
 			{
 				return &mAssetsByUUID;
 			}
@@ -374,7 +374,7 @@ namespace Enjon
 		protected:
 			
 			HashMap< String, AssetRecordInfo* > mAssetsByName;
-			HashMap< String, AssetRecordInfo > mAssetsByUUID;
+			HashMap< UUID, AssetRecordInfo > mAssetsByUUID;
 			Asset* mDefaultAsset = nullptr;
 
 		private: 
@@ -182,7 +182,7 @@ namespace Enjon
 			/**
 			*@brief
 			*/
-			const HashMap< Enjon::String, AssetRecordInfo >* GetAssets( const Enjon::MetaClass* cls ) const;
+			const HashMap< UUID, AssetRecordInfo >* GetAssets( const Enjon::MetaClass* cls ) const;
 
 			/**
 			*@brief Searches for specific loader based on class id. Returns true if found, false otherwise.
@@ -198,7 +198,7 @@ namespace Enjon
 			*@brief Gets all assets of specific type
 			*/
 			template <typename T>
-			const HashMap< String, AssetRecordInfo >* GetAssets( ) const; 
+			const HashMap< UUID, AssetRecordInfo >* GetAssets( ) const; 
 
 			/**
 			*@brief
@@ -66,7 +66,7 @@ void AssetManager::UnloadAssets( )
 //================================================================================================ 
 
 template <typename T>
-const HashMap< String, AssetRecordInfo >* AssetManager::GetAssets( ) const
+const HashMap< UUID, AssetRecordInfo >* AssetManager::GetAssets( ) const
 {
 	// Get appropriate loader based on asset type
 	u32 loaderId = GetAssetTypeId<T>( );
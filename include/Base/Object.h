@@ -65,7 +65,8 @@ namespace Enjon
 		IsPointer		 = 0x01,
 		NonSerializeable = 0x02,
 		ReadOnly		 = 0x04,
-		HideInEditor	 = 0x08
+		HideInEditor	 = 0x08,
+		InstanceShared	 = 0x10
 	};
 
 	enum class MergeType
@@ -284,6 +285,14 @@ namespace Enjon
 				mOnValueChangedCallbacks.push_back( cb );
 			}
 
+			/*
+			* @brief Whether setting this property through its meta class runs any mutators or value changed callbacks
+			*/
+			bool HasValueCallbacks( ) const
+			{
+				return ( !mMutatorCallbacks.empty( ) || !mOnValueChangedCallbacks.empty( ) );
+			}
+
 		protected:
 			MetaPropertyType mType;
 			String mName;
@@ -932,6 +941,7 @@ namespace Enjon
 	typedef Vector< MetaProperty* > PropertyTable;
 	typedef HashMap< Enjon::String, MetaFunction* > FunctionTable;
 	typedef std::function< Object*( void ) > ConstructFunction;
+	typedef std::function< Object*( void* ) > PlacementConstructFunction;
 
 	enum class MetaClassType
 	{
@@ -1200,6 +1210,42 @@ namespace Enjon
 				return nullptr;
 			}
 
+			/*
+			* @brief Constructs object in place at given memory address. Memory must be at least GetTypeSize() bytes and aligned to GetTypeAlignment().
+			*/
+			Object* PlacementConstruct( void* memory ) const
+			{
+				if ( mPlacementConstructor && memory )
+				{
+					return mPlacementConstructor( memory );
+				}
+				return nullptr;
+			}
+
+			/*
+			* @brief Returns whether or not class can be constructed in place ( requires reflected size information )
+			*/
+			bool CanPlacementConstruct( ) const
+			{
+				return ( mPlacementConstructor != nullptr && mTypeSize > 0 );
+			}
+
+			/*
+			* @brief Size in bytes of reflected type, 0 if not available
+			*/
+			usize GetTypeSize( ) const
+			{
+				return mTypeSize;
+			}
+
+			/*
+			* @brief Alignment in bytes of reflected type, 0 if not available
+			*/
+			usize GetTypeAlignment( ) const
+			{
+				return mTypeAlignment;
+			}
+
 		protected:
 
 			virtual void Destroy( )
@@ -1217,6 +1263,9 @@ namespace Enjon
 
 			// Not sure if this is the best way to do this, but whatever...
 			ConstructFunction mConstructor = nullptr;
+			PlacementConstructFunction mPlacementConstructor = nullptr;
+			usize mTypeSize = 0;
+			usize mTypeAlignment = 0;
 	};
 
 	class MetaClassComponent : public MetaClass
@@ -1238,17 +1287,44 @@ namespace Enjon
 				return mRequiredComponentList;
 			}
 
+			/*
+			* @brief Classes this component reads during its update. Used to schedule component updates in parallel.
+			*/
+			const Vector< String >& GetReadComponentList( ) const
+			{
+				return mReadComponentList;
+			}
+
+			/*
+			* @brief Classes this component writes during its update. Used to schedule component updates in parallel.
+			*/
+			const Vector< String >& GetWriteComponentList( ) const
+			{
+				return mWriteComponentList;
+			}
+
+			/*
+			* @brief Whether or not component has declared any read or write access
+			*/
+			bool HasDeclaredAccess( ) const
+			{
+				return ( !mReadComponentList.empty( ) || !mWriteComponentList.empty( ) );
+			}
 
 		protected:
 
 			virtual void Destroy( ) override
 			{
 				mRequiredComponentList.clear( );
+				mReadComponentList.clear( );
+				mWriteComponentList.clear( );
 			}
 
 		protected: 
 
 			Vector< String > mRequiredComponentList;
+			Vector< String > mReadComponentList;
+			Vector< String > mWriteComponentList;
 	};
 
 	class MetaClassRegistry
@@ -1554,6 +1630,12 @@ namespace Enjon
 			* @brief
 			*/
 			virtual Result DeserializeLateInit( );
+
+			/*
+			* @brief Copies data directly from source object of the same class. Classes that override SerializeData() / DeserializeData()
+			*		 should override this to match, otherwise returns INCOMPLETE and default property copy is used.
+			*/
+			virtual Result CopyData( const Object* source );
  
 			/*
 			* @brief
@@ -1580,6 +1662,12 @@ namespace Enjon
 			*/
 			virtual Result HasPropertyOverrides( bool& result ) const;
 
+			/*
+			* @brief Object the value of given property is read from. Objects reading some of their properties through to
+			*		 another object return that object for them, otherwise this.
+			*/
+			virtual const Object* GetPropertySource( const MetaProperty* prop ) const;
+
 		private:
 
 			/**
@@ -8,8 +8,9 @@
 #include "Defines.h"
 #include "System/Types.h" 
 
+// Resolves to pointer cached when subsystem was registered in InitSubsystems
 #define EngineSubsystem(type)\
-	Engine::GetInstance()->GetSubsystemCatalog()->Get<type>()->ConstCast<type>()
+	SubsystemCatalog::GetCached<type>()
 
 namespace Enjon
 { 
@@ -25,6 +26,7 @@ namespace Enjon
 	class ImGuiManager;
 	class EntityManager;
 	class SceneManager;
+	class JobSystem;
 	class MetaClass;
 	class Subsystem;
 	
@@ -255,6 +257,7 @@ namespace Enjon
 			SceneManager*		mSceneManager		= nullptr;
 			ImGuiManager*		mImGuiManager		= nullptr;
 			AnimationSubsystem* mAnimationSystem	= nullptr;
+			JobSystem*			mJobSystem			= nullptr;
 			World*				mWorld				= nullptr;
 
 			// Engine configuration settings
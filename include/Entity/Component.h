@@ -3,9 +3,11 @@
 #define ENJON_COMPONENT_H 
 
 #include "Entity/EntityDefines.h"
+#include "Entity/ComponentPool.h"
 #include "Math/Transform.h"
 #include "System/Types.h"
 #include "Base/Object.h"
+#include "Base/StaticTypeId.h"
 
 #include <assert.h>
 #include <array>
@@ -13,6 +15,8 @@
 #include <bitset>
 #include <type_traits>
 #include <unordered_map> 
+#include <limits>
+#include <atomic>
 
 namespace Enjon 
 { 
@@ -20,6 +24,18 @@ namespace Enjon
 	class Entity;
 	class EntityManager;
 	class Component;
+	class World;
+	class EntityArchiver;
+
+	/**
+	* @brief Change counts of one component type for a single version
+	*/
+	struct ComponentChangeStats
+	{
+		u32 mVersion = 0;
+		u32 mChanged = 0;
+		u32 mTotal = 0;
+	};
 
 	class ComponentWrapperBase
 	{
@@ -32,12 +48,12 @@ namespace Enjon
 
 			virtual bool HasEntity( const u32& entityID ) = 0;
 
-			virtual Component* AddComponent( const u32& entityId, Component* component ) = 0;
-
 			virtual Component* AddComponent( const MetaClass* cls, const u32& entityId ) = 0;
 
 			virtual void RemoveComponent( const u32& entityId ) = 0; 
 
+			virtual void FreeComponent( Component* component ) = 0;
+
 			virtual Component* GetComponent( const u32& entityId ) = 0;
 
 			virtual bool IsEmpty( ) const = 0;
@@ -47,9 +63,47 @@ namespace Enjon
 			virtual Vector<Component*> GetComponents( ) = 0;
 
 			virtual void Update( ) = 0;
+
+			virtual void ReleaseAll( ) = 0;
+
+			virtual const ComponentPoolStats& GetPoolStats( ) const = 0;
+
+			virtual void Reserve( const u32& count, const u32& entityCapacity ) = 0;
+
+			virtual void RefreshTickEntry( Component* component ) = 0;
+
+			virtual void MarkChanged( Component* component ) = 0;
+
+			virtual void AdvanceChangeVersion( ) = 0;
+
+			virtual const ComponentChangeStats& GetChangeStats( ) const = 0;
+	};
+
+	enum class ComponentTickState
+	{
+		TickAlways,
+		TickOnRunOnly
+	};
+
+	/**
+	* @brief Components of one array that share world, tick state and tick interval. In storage order when last compacted, 
+	*		 with components filed since appended. Removed components leave a null entry until the next compaction.
+	*/
+	struct ComponentTickList
+	{
+		const World* mWorld = nullptr;
+		ComponentTickState mTickState = ComponentTickState::TickOnRunOnly;
+		u32 mTickInterval = 1;
+		Vector< Component* > mComponents;
+	};
+
+	enum class ComponentStorageMode
+	{
+		Heap,
+		Chunked
 	};
 
-	class ComponentArray : public ComponentWrapperBase
+	class ComponentArray final : public ComponentWrapperBase
 	{
 		friend Entity;
 		friend EntityManager;
@@ -58,52 +112,51 @@ namespace Enjon
 		public:
 			virtual void Base( ) override {}
 
-			ComponentArray( );
+			/**
+			* @brief Components of given class are constructed in place inside contiguous chunks if the class 
+			*		 has reflected size information, otherwise they are individually heap allocated.
+			*/
+			ComponentArray( const MetaClass* cls );
 
 			~ComponentArray( );
 
 			using ComponentPtrs = Vector<Component*>; 
-			using ComponentMap = HashMap<u32, Component*>;
+			using EntitySlotArray = Vector<u32>;
+
+			// Sparse entry for entities without a component of this type
+			static const u32 InvalidSlot = std::numeric_limits< u32 >::max( );
 
 			/**
-			* @brief
+			* @brief Updates components through their tick lists. Lists for worlds that aren't updating and for run only
+			*		 components while the application isn't running are skipped as a whole.
 			*/
 			virtual void Update( ) override;
 
-			virtual Component* AddComponent( const u32& entityId, Component* component ) override
-			{
-				mComponentMap[entityId] = component;
-				mComponentPtrs.push_back( mComponentMap[entityId] );
-				return mComponentMap[entityId];
-			}
-
-			virtual Component* AddComponent( const MetaClass* cls, const u32& entityId ) override
-			{
-				// If not available then add component - otherwise return component that's already allocated
-				if ( !HasEntity( entityId ) )
-				{
-					mComponentMap[entityId] = (Component*)cls->Construct( );
-					mComponentPtrs.push_back( mComponentMap[entityId] );
-				}
-
-				return mComponentMap[entityId];
-			}
+			/**
+			* @brief Constructs new component for entity. If already available, returns the existing component.
+			*/
+			virtual Component* AddComponent( const MetaClass* cls, const u32& entityId ) override;
 
 			/**
-			* @brief
+			* @brief Unlinks component from entity. Memory is not released until FreeComponent() is called.
 			*/
 			virtual void RemoveComponent( const u32& entityId ) override;
 
+			/**
+			* @brief Destructs component and returns its storage slot for reuse.
+			*/
+			virtual void FreeComponent( Component* component ) override;
+
 			virtual bool HasEntity( const u32& entityID ) override
 			{
-				return ( mComponentMap.find( entityID ) != mComponentMap.end( ) );
+				return ( entityID < mEntitySlots.size( ) && mEntitySlots[ entityID ] != InvalidSlot );
 			}
 
 			virtual Component* GetComponent( const u32& entityID ) override
 			{
 				if ( HasEntity( entityID ) )
 				{
-					return mComponentMap[entityID];
+					return mSlotComponents[ mEntitySlots[ entityID ] ];
 				}
 
 				return nullptr;
@@ -111,7 +164,7 @@ namespace Enjon
 
 			virtual u32 GetSize( ) const override
 			{
-				return mComponentPtrs.size( );
+				return mCount;
 			}
 
 			virtual bool IsEmpty( ) const override
@@ -119,30 +172,173 @@ namespace Enjon
 				return ( GetSize( ) == 0 );
 			}
 
-			virtual Vector<Component*> GetComponents( ) override
+			virtual Vector<Component*> GetComponents( ) override;
+
+			/**
+			* @brief Destructs every component at once and resets the pool. Caller is responsible for any shutdown logic beforehand.
+			*/
+			virtual void ReleaseAll( ) override;
+
+			/**
+			* @brief Reserves storage for count more components and sparse entries for all entity ids below entity capacity
+			*/
+			virtual void Reserve( const u32& count, const u32& entityCapacity ) override;
+
+			/**
+			* @brief Moves component to the tick list matching its current world, tick state and tick interval before next update
+			*/
+			virtual void RefreshTickEntry( Component* component ) override;
+
+			/**
+			* @brief Stamps component's slot with the current change version
+			*/
+			virtual void MarkChanged( Component* component ) override;
+
+			/**
+			* @brief Closes out current change version, recording its stats, and starts the next one. Called once per frame.
+			*/
+			virtual void AdvanceChangeVersion( ) override;
+
+			/**
+			* @brief Version components changed from now on will be stamped with
+			*/
+			u32 GetChangeVersion( ) const
+			{
+				return mChangeVersion;
+			}
+
+			/**
+			* @brief Changed and total component counts for the last completed version
+			*/
+			virtual const ComponentChangeStats& GetChangeStats( ) const override
+			{
+				return mLastChangeStats;
+			}
+
+			/**
+			* @brief Calls func( Component* ) in storage order for every linked component changed at or after given version.
+			*		 Systems remember GetChangeVersion( ) from before they iterate and pass it in next time, so changes made
+			*		 later in the same version are seen again rather than missed.
+			*/
+			template < typename Func >
+			void ForEachChangedSince( const u32& version, Func func ) const
+			{
+				for ( u32 slot = 0; slot < mSlotComponents.size( ); ++slot )
+				{
+					if ( mSlotVersions[ slot ] >= version && mSlotEntities[ slot ] != INVALID_ENTITY_ID )
+					{
+						func( mSlotComponents[ slot ] );
+					}
+				}
+			}
+
+			/**
+			* @brief
+			*/
+			const Vector< ComponentTickList >& GetTickLists( )
 			{
-				return mComponentPtrs;
+				UpdateTickLists( );
+				return mTickLists;
+			}
+
+			/**
+			* @brief
+			*/
+			virtual const ComponentPoolStats& GetPoolStats( ) const override
+			{
+				return mPool.GetStats( );
+			}
+
+			/**
+			* @brief
+			*/
+			ComponentStorageMode GetStorageMode( ) const
+			{
+				return mStorageMode;
+			}
+
+			/**
+			* @brief Number of storage slots, including free and unlinked slots
+			*/
+			u32 GetSlotCount( ) const
+			{
+				return ( u32 )mSlotComponents.size( );
+			}
+
+			/**
+			* @brief Entity linked to storage slot, INVALID_ENTITY_ID if slot is free or unlinked
+			*/
+			u32 GetSlotEntity( const u32& slot ) const
+			{
+				return mSlotEntities[ slot ];
+			}
+
+			/**
+			* @brief
+			*/
+			Component* GetSlotComponent( const u32& slot ) const
+			{
+				return mSlotComponents[ slot ];
 			}
 
 		private:
-			ComponentPtrs mComponentPtrs;
-			ComponentMap mComponentMap; 
-	};
 
-	using ComponentID = u32;
+			/**
+			* @brief Destructs component and releases heap memory if it owns any
+			*/
+			void DestructComponent( Component* component );
 
-	enum class ComponentTickState
-	{
-		TickAlways,
-		TickOnRunOnly
+			/**
+			* @brief Files components added or moved since last update into their lists. Compacts all lists instead once 
+			*		 entries of removed components make up COMPONENT_TICK_LIST_COMPACT_PERCENT of them.
+			*/
+			void UpdateTickLists( );
+
+			/**
+			* @brief Groups all linked components by world, tick state and tick interval, in storage order
+			*/
+			void RebuildTickLists( );
+
+			/**
+			* @brief Appends component in slot to its matching tick list, creating the list if needed
+			*/
+			void AppendTickEntry( const u32& slot );
+
+			/**
+			* @brief Nulls out tick list entry of component in slot, if it has one
+			*/
+			void UnlinkTickEntry( const u32& slot );
+
+		private:
+			const MetaClass* mClass = nullptr;
+			ComponentStorageMode mStorageMode = ComponentStorageMode::Heap;
+			ComponentPool mPool;
+			u32 mCount = 0;
+			ComponentPtrs mSlotComponents;
+			Vector<u32> mSlotEntities;
+			EntitySlotArray mEntitySlots; 
+			Vector< ComponentTickList > mTickLists;
+			Vector< u32 > mSlotTickLists;
+			Vector< u32 > mSlotTickEntries;
+			Vector< u32 > mPendingTickSlots;
+			u32 mTickEntryCount = 0;
+			u32 mDeadTickEntryCount = 0;
+			u32 mTickFrame = 0;
+			Vector< u32 > mSlotVersions;
+			u32 mChangeVersion = 1;
+			std::atomic< u32 > mChangedCount{ 0 };
+			ComponentChangeStats mLastChangeStats;
 	};
 
+	using ComponentID = u32;
+
 	class Component : public Enjon::Object
 	{
 		friend Entity;
 		friend EntityManager; 
 		friend ComponentWrapperBase;
 		friend ComponentArray;
+		friend EntityArchiver;
 
 		public:
 
@@ -190,6 +386,11 @@ namespace Enjon
 			*/
 			u32 GetID() const { return mComponentID; } 
 
+			/**
+			* @brief Flags component as changed in its component array's current change version
+			*/
+			void MarkChanged( );
+
 			/**
 			* @brief
 			*/
@@ -198,6 +399,24 @@ namespace Enjon
 				return mTickState;
 			}
 
+			/**
+			* @brief
+			*/
+			void SetTickState( const ComponentTickState& state );
+
+			/**
+			* @brief Number of frames between updates. Components sharing an interval are spread evenly across those frames.
+			*/
+			u32 GetTickInterval( ) const
+			{
+				return mTickInterval;
+			}
+
+			/**
+			* @brief Updates component only every given number of frames, 1 updates every frame
+			*/
+			void SetTickInterval( const u32& frames );
+
 			virtual void AddToWorld( World* world )
 			{ 
 			} 
@@ -206,8 +425,54 @@ namespace Enjon
 			{ 
 			}
 
+			/**
+			* @brief Component this one reads its InstanceShared properties from, nullptr if it owns its own copies
+			*/
+			const Component* GetSharedSource( ) const
+			{
+				return mSharedSource;
+			}
+
+			/**
+			* @brief Takes private copies of all InstanceShared properties from shared source. Given property, if any, is 
+			*		 recorded as overridden since it's about to diverge from the source.
+			*/
+			void DetachSharedSource( const MetaProperty* writtenProp = nullptr );
+
+			/**
+			* @brief Shared source for InstanceShared properties, this for everything else
+			*/
+			virtual const Object* GetPropertySource( const MetaProperty* prop ) const override;
+
 		protected:
 
+			/**
+			* @brief Reads InstanceShared property, going through to the shared source until this component writes its own
+			*/
+			template < typename C, typename T >
+			const T& ReadShared( T C::* member ) const
+			{
+				static_assert( std::is_base_of< Component, C >::value, "ReadShared:: C must inherit from Component." );
+				const Component* owner = mSharedSource ? mSharedSource : this;
+				return static_cast< const C* >( owner )->*member;
+			}
+
+			/**
+			* @brief Returns InstanceShared property for writing, detaching from shared source first if needed
+			*/
+			template < typename C, typename T >
+			T& WriteShared( T C::* member )
+			{
+				static_assert( std::is_base_of< Component, C >::value, "WriteShared:: C must inherit from Component." );
+				C* self = static_cast< C* >( this );
+				if ( mSharedSource )
+				{
+					DetachSharedSourceAtOffset( ( usize )( ( const u8* )&( self->*member ) - ( const u8* )self ) );
+				}
+
+				return self->*member;
+			}
+
 			/**
 			* @brief
 			*/
@@ -245,6 +510,33 @@ namespace Enjon
 			*/
 			void SetBase( ComponentWrapperBase* base );
 
+			/**
+			* @brief Lets owning component array know this component's world, tick state or tick interval changed
+			*/
+			void RefreshTickEntry( );
+
+			/**
+			* @brief Reads InstanceShared properties through to given component from now on. Returns false if class has none.
+			*/
+			bool SetSharedSource( const Component* source );
+
+			/**
+			* @brief Detaches from shared source, recording override for property at given offset
+			*/
+			void DetachSharedSourceAtOffset( const usize& writtenOffset );
+
+			/**
+			* @brief Stops reading through to shared source without copying anything. Swaps the source's last instance into
+			*		 this one's place in its list, so takes constant time.
+			*/
+			void UnlinkSharedSource( );
+
+			/**
+			* @brief Unregisters from shared source and lets instances reading from this component take copies ( or just 
+			*		 forget about it if they're being released along with it ). Called right before destruction.
+			*/
+			void ReleaseSharedData( bool detachInstances );
+
 			/**
 			* @brief
 			*/
@@ -252,20 +544,27 @@ namespace Enjon
 			static inline ComponentID GetComponentType() noexcept
 			{
 				static_assert( std::is_base_of<Component, T>::value, "Component:: T must inherit from Component." );	
-				return Engine::GetInstance( )->GetMetaClassRegistry( )->GetTypeId< T >( );
+				return GetStaticTypeId< T >( );
 			}
 
 		protected:
 			Entity* mEntity = nullptr;
 			EntityManager* mManager = nullptr;
 
+			// Set directly only during construction, afterwards use SetTickState( ) so tick lists are updated
 			ComponentTickState mTickState = ComponentTickState::TickOnRunOnly;
+			u32 mTickInterval = 1;
 
 			u32 mEntityID; 
 			u32 mComponentID = 0;
 
 		private:
 			ComponentWrapperBase* mBase = nullptr; 
+			u32 mStorageSlot = 0;
+			const Component* mSharedSource = nullptr;
+			u32 mSharedInstanceIndex = 0;
+			// Instances reading through to this component, allocated once it has any
+			Vector< Component* >* mSharedInstances = nullptr;
 	}; 
 
 
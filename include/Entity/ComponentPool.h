@@ -0,0 +1,126 @@
+// File: ComponentPool.h
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#ifndef ENJON_COMPONENT_POOL_H
+#define ENJON_COMPONENT_POOL_H
+#pragma once
+
+#include "Entity/EntityDefines.h"
+#include "System/Types.h"
+#include "Defines.h"
+
+namespace Enjon
+{
+	struct ComponentPoolStats
+	{
+		/**
+		* @brief Ratio of allocations that were served from the free list
+		*/
+		f32 GetReuseRate( ) const
+		{
+			return mTotalAllocations ? ( f32 )mReusedAllocations / ( f32 )mTotalAllocations : 0.0f;
+		}
+
+		u32 mTotalAllocations = 0;
+		u32 mReusedAllocations = 0;
+		u32 mTotalFrees = 0;
+		u32 mLiveCount = 0;
+		u32 mPeakLiveCount = 0;
+		u32 mChunkCount = 0;
+		u32 mBulkReleases = 0;
+	};
+
+	/**
+	* @brief Slab allocator handing out fixed size slots from contiguous chunks. Freed slots are
+	*		 reused through a free list. A stride of 0 only hands out slot indices without memory.
+	*/
+	class ComponentPool
+	{
+		public:
+
+			/**
+			* @brief Constructor
+			*/
+			ComponentPool( const usize& stride = 0, const u32& chunkCapacity = COMPONENT_CHUNK_CAPACITY );
+
+			/**
+			* @brief Destructor
+			*/
+			~ComponentPool( );
+
+			/**
+			* @brief Returns index of newly allocated slot
+			*/
+			u32 Allocate( );
+
+			/**
+			* @brief Returns slot to free list
+			*/
+			void Free( const u32& slot );
+
+			/**
+			* @brief Makes sure the next count allocations won't need to allocate any chunks
+			*/
+			void Reserve( const u32& count );
+
+			/**
+			* @brief Forgets all allocated slots at once. Chunks are kept for reuse. Anything living in the pool must already be destructed.
+			*/
+			void ReleaseAll( );
+
+			/**
+			* @brief Frees all chunk memory. Anything living in the pool must already be destructed.
+			*/
+			void Shrink( );
+
+			/**
+			* @brief Address of slot inside of its chunk, nullptr if pool doesn't own memory
+			*/
+			u8* GetMemory( const u32& slot ) const
+			{
+				return mStride ? mChunks[ slot / mChunkCapacity ] + ( slot % mChunkCapacity ) * mStride : nullptr;
+			}
+
+			/**
+			* @brief Number of slots ever handed out since last release ( live and free )
+			*/
+			u32 GetSlotCount( ) const
+			{
+				return mSlotCount;
+			}
+
+			/**
+			* @brief
+			*/
+			usize GetStride( ) const
+			{
+				return mStride;
+			}
+
+			/**
+			* @brief Bytes currently reserved by chunks
+			*/
+			usize GetReservedBytes( ) const
+			{
+				return mChunks.size( ) * mChunkCapacity * mStride;
+			}
+
+			/**
+			* @brief
+			*/
+			const ComponentPoolStats& GetStats( ) const
+			{
+				return mStats;
+			}
+
+		private:
+			usize mStride = 0;
+			u32 mChunkCapacity = COMPONENT_CHUNK_CAPACITY;
+			u32 mSlotCount = 0;
+			Vector< u8* > mChunks;
+			Vector< u32 > mFreeSlots;
+			ComponentPoolStats mStats;
+	};
+}
+
+#endif
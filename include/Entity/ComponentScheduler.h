@@ -0,0 +1,125 @@
+// File: ComponentScheduler.h
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#ifndef ENJON_COMPONENT_SCHEDULER_H
+#define ENJON_COMPONENT_SCHEDULER_H
+#pragma once
+
+#include "System/Types.h"
+#include "Defines.h"
+
+namespace Enjon
+{
+	class ComponentWrapperBase;
+	class JobSystem;
+	class MetaClass;
+
+	struct ComponentAccess
+	{
+		Vector< u32 > mReads;
+		Vector< u32 > mWrites;
+		bool mDeclared = false;
+	};
+
+	struct ComponentUpdateTrace
+	{
+		u32 mComponentType = 0;
+		u32 mWave = 0;
+		u32 mThreadIndex = 0;
+		f32 mStartMS = 0.0f;
+		f32 mDurationMS = 0.0f;
+	};
+
+	/**
+	* @brief Orders component array updates into waves. Updates within a wave have no conflicting reads or writes
+	*		 and run concurrently on the job system, with a barrier between waves. Component types that haven't
+	*		 declared their access are treated as exclusive and run on their own.
+	*/
+	class ComponentScheduler
+	{
+		public:
+
+			/**
+			* @brief Constructor
+			*/
+			ComponentScheduler( ) = default;
+
+			/**
+			* @brief Destructor
+			*/
+			~ComponentScheduler( ) = default;
+
+			/**
+			* @brief Resolves read / write access from reflected component meta class
+			*/
+			void RegisterAccess( const MetaClass* cls );
+
+			/**
+			* @brief Overrides access for component type. Every component type implicitly writes itself.
+			*/
+			void SetAccess( const MetaClass* cls, const Vector< const MetaClass* >& reads, const Vector< const MetaClass* >& writes );
+
+			/**
+			* @brief
+			*/
+			void RemoveAccess( const MetaClass* cls );
+
+			/**
+			* @brief Updates all given component arrays in conflict free waves. Update order of conflicting types
+			*		 matches order of given type list.
+			*/
+			void Run( const Vector< u32 >& types, const Vector< ComponentWrapperBase* >& arrays, JobSystem* jobSystem );
+
+			/**
+			* @brief Whether or not the two component types can update at the same time
+			*/
+			bool Conflicts( const u32& a, const u32& b ) const;
+
+			/**
+			* @brief Timing and thread placement of every component update from last frame
+			*/
+			const Vector< ComponentUpdateTrace >& GetLastFrameTrace( ) const
+			{
+				return mTrace;
+			}
+
+			/**
+			* @brief Component types grouped by wave from last frame
+			*/
+			const Vector< Vector< u32 > >& GetLastFrameWaves( ) const
+			{
+				return mWaves;
+			}
+
+			/**
+			* @brief Runs all waves serially on the calling thread when disabled
+			*/
+			void EnableParallelUpdates( bool enabled )
+			{
+				mParallelEnabled = enabled;
+			}
+
+			/**
+			* @brief
+			*/
+			bool ParallelUpdatesEnabled( ) const
+			{
+				return mParallelEnabled;
+			}
+
+		private:
+
+			/**
+			* @brief
+			*/
+			const ComponentAccess* GetAccess( const u32& type ) const;
+
+		private:
+			HashMap< u32, ComponentAccess > mAccess;
+			Vector< Vector< u32 > > mWaves;
+			Vector< ComponentUpdateTrace > mTrace;
+			bool mParallelEnabled = true;
+	};
+}
+
+#endif
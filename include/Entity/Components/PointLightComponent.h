@@ -10,7 +10,7 @@ namespace Enjon
 	ENJON_CLASS( )
 	class PointLightComponent : public Component
 	{ 
-		ENJON_COMPONENT( PointLightComponent )
+		ENJON_COMPONENT( PointLightComponent, Reads[ Entity ] )
 
 		public:
 
@@ -3,6 +3,12 @@ template <typename T>
 bool Entity::HasComponent()
 {
 	u32 compId = Component::GetComponentType< T >( );
+	u64 mask = EngineSubsystem( EntityManager )->GetComponentMask( compId );
+	if ( mask )
+	{
+		return ( mHot->mComponentMask & mask ) != 0;
+	}
+
 	auto query = std::find( mComponents.begin( ), mComponents.end( ), compId );
 	return ( query != mComponents.end( ) );
 }
@@ -0,0 +1,197 @@
+// File: EntityCommandBuffer.h
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#ifndef ENJON_ENTITY_COMMAND_BUFFER_H
+#define ENJON_ENTITY_COMMAND_BUFFER_H
+#pragma once
+
+#include "Entity/EntityDefines.h"
+#include "Base/Object.h"
+#include "System/Types.h"
+#include "Defines.h"
+
+#include <functional>
+
+namespace Enjon
+{
+	class Component;
+	class EntityHandle;
+	class EntityManager;
+	class World;
+
+	enum class EntityCommandType
+	{
+		CreateEntity,
+		DestroyEntity,
+		AddComponent,
+		RemoveComponent,
+		SetProperty
+	};
+
+	/**
+	* @brief Entity recorded for creation in a command buffer. Only valid for commands recorded into that same buffer.
+	*/
+	struct DeferredEntity
+	{
+		u32 mIndex = INVALID_ENTITY_ID;
+	};
+
+	/**
+	* @brief Entity a command applies to, either an existing entity or one created by an earlier command
+	*/
+	struct EntityCommandTarget
+	{
+		EntityCommandTarget( const EntityHandle& handle );
+		EntityCommandTarget( const DeferredEntity& entity );
+
+		u32 mID = INVALID_ENTITY_ID;
+		u32 mGeneration = 0;
+		u32 mDeferredIndex = INVALID_ENTITY_ID;
+	};
+
+	using ComponentCommandFunction = std::function< void( Component* ) >;
+
+	struct EntityCommand
+	{
+		EntityCommandType mType;
+		EntityCommandTarget mTarget;
+		u32 mSortKey = 0;
+		const MetaClass* mClass = nullptr;
+		ComponentCommandFunction mApply;
+	};
+
+	/**
+	* @brief Records structural changes to entities and components so they can be made from job threads. Each thread
+	*		 records into its own buffer, which the entity manager plays back on the main thread at its next sync point.
+	*		 Commands are played back ordered by sort key, then by thread index, then in the order they were recorded.
+	*		 Jobs should set a sort key that doesn't depend on scheduling ( such as their batch index ) so playback is
+	*		 deterministic regardless of which thread ran them.
+	*/
+	class EntityCommandBuffer
+	{
+		friend EntityManager;
+
+		public:
+
+			/**
+			* @brief Constructor
+			*/
+			EntityCommandBuffer( ) = default;
+
+			/**
+			* @brief Destructor
+			*/
+			~EntityCommandBuffer( ) = default;
+
+			/**
+			* @brief Sort key applied to all commands recorded from here on
+			*/
+			void SetSortKey( const u32& key )
+			{
+				mSortKey = key;
+			}
+
+			/**
+			* @brief Records creation of a new entity in given world ( default world if null )
+			*/
+			DeferredEntity CreateEntity( World* world = nullptr );
+
+			/**
+			* @brief Records destruction of entity
+			*/
+			void DestroyEntity( const EntityCommandTarget& target );
+
+			/**
+			* @brief Records adding component of given type to entity. Optional func is called with the component once added.
+			*/
+			void AddComponent( const EntityCommandTarget& target, const MetaClass* compCls, const ComponentCommandFunction& func = nullptr );
+
+			/**
+			* @brief Records adding component to entity. Optional func is called with the component once added.
+			*/
+			template < typename T >
+			void AddComponent( const EntityCommandTarget& target, const std::function< void( T* ) >& func = nullptr )
+			{
+				ComponentCommandFunction apply = nullptr;
+				if ( func )
+				{
+					apply = [ func ]( Component* c )
+					{
+						func( static_cast< T* >( c ) );
+					};
+				}
+
+				AddComponent( target, Object::GetClass< T >( ), apply );
+			}
+
+			/**
+			* @brief Records removing component of given type from entity
+			*/
+			void RemoveComponent( const EntityCommandTarget& target, const MetaClass* compCls );
+
+			/**
+			* @brief Records removing component from entity
+			*/
+			template < typename T >
+			void RemoveComponent( const EntityCommandTarget& target )
+			{
+				RemoveComponent( target, Object::GetClass< T >( ) );
+			}
+
+			/**
+			* @brief Records setting reflected property of entity's component of given type. Ignored at playback if the
+			*		 entity doesn't have the component by then.
+			*/
+			template < typename T >
+			void SetProperty( const EntityCommandTarget& target, const MetaClass* compCls, const String& propertyName, const T& value )
+			{
+				const MetaProperty* prop = compCls ? compCls->GetPropertyByName( propertyName ) : nullptr;
+				assert( prop != nullptr );
+				if ( !prop )
+				{
+					return;
+				}
+
+				Record( EntityCommandType::SetProperty, target, compCls, [ compCls, prop, value ]( Component* c )
+				{
+					compCls->SetValue( c, prop, value );
+				} );
+			}
+
+			/**
+			* @brief Records setting reflected property of entity's component
+			*/
+			template < typename C, typename T >
+			void SetProperty( const EntityCommandTarget& target, const String& propertyName, const T& value )
+			{
+				SetProperty( target, Object::GetClass< C >( ), propertyName, value );
+			}
+
+			/**
+			* @brief Number of commands waiting for playback
+			*/
+			u32 GetCommandCount( ) const
+			{
+				return ( u32 )mCommands.size( );
+			}
+
+			/**
+			* @brief Drops all recorded commands without playing them back
+			*/
+			void Clear( );
+
+		private:
+
+			/**
+			* @brief
+			*/
+			void Record( const EntityCommandType& type, const EntityCommandTarget& target, const MetaClass* compCls, const ComponentCommandFunction& func );
+
+		private:
+			Vector< EntityCommand > mCommands;
+			Vector< World* > mDeferredWorlds;
+			u32 mSortKey = 0;
+	};
+}
+
+#endif
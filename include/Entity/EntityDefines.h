@@ -2,7 +2,28 @@
 #ifndef ENJON_ENTITY_DEFINES_H
 #define ENJON_ENTITY_DEFINES_H
 
-#define MAX_ENTITIES 	50000
 #define MAX_COMPONENTS 	64
 
+// Id used by handles and lookups that don't refer to any entity
+#define INVALID_ENTITY_ID 	0xFFFFFFFF
+
+// Number of entities allocated together in one storage page. Pages never move, so entity addresses stay stable.
+#define ENTITY_PAGE_SIZE 	1024
+
+// First renderable id reserved for renderables that aren't owned by entities ( editor widgets ). Object picking 
+// encodes ids in 24 bits, so only entities with ids below this can be picked.
+#define RESERVED_RENDERABLE_ID_BEGIN 	0x00FFFF00
+
+// Number of components stored contiguously per storage chunk
+#define COMPONENT_CHUNK_CAPACITY 	128
+
+// Number of entities per job when propagating a level of the transform hierarchy
+#define TRANSFORM_PROPAGATION_BATCH_SIZE 	512
+
+// Number of driving component slots per job when iterating an entity query in parallel
+#define ENTITY_QUERY_BATCH_SIZE 	256
+
+// Component tick lists are compacted once entries of removed components make up this percentage of them
+#define COMPONENT_TICK_LIST_COMPACT_PERCENT 	25
+
 #endif
\ No newline at end of file
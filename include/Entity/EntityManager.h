@@ -6,9 +6,13 @@
 #pragma once
 
 #include "Entity/Component.h"
+#include "Entity/ComponentScheduler.h"
+#include "Entity/EntityCommandBuffer.h"
+#include "Entity/EntityQuery.h"
 #include "Entity/Entity.h"
 #include "Entity/EntityDefines.h"
 #include "Math/Transform.h" 
+#include "Math/TransformStream.h"
 #include "Base/Object.h"
 #include "System/Types.h"
 #include "Serialize/UUID.h"
@@ -19,6 +23,7 @@
 #include "Entity/Archetype.h"
 #include "Asset/Asset.h"
 #include "Engine.h"
+#include "System/JobSystem.h"
 
 #include <array>
 #include <vector>
@@ -41,6 +46,7 @@ namespace Enjon
 	// Forward declaration
 	class Entity;
 	class EntityManager;
+	class EntityStorage;
 
 	ENJON_CLASS( )
 	class EntitySubsystemContext : public SubsystemContext
@@ -89,6 +95,11 @@ namespace Enjon
 		*/
 		u32 GetID( ) const;
 
+		/*
+		* @brief Generation of entity slot at the time this handle was created
+		*/
+		u32 GetGeneration( ) const;
+
 		/*
 		* @brief
 		*/
@@ -110,12 +121,39 @@ namespace Enjon
 		explicit operator bool( );
 
 		/*
-		* @brief
+		* @brief Returns entity if still alive, nullptr if destroyed or its slot has since been reused
 		*/
 		Enjon::Entity* Get( ) const;
 
 	private:
-		u32 mID = MAX_ENTITIES;
+		u32 mID = INVALID_ENTITY_ID;
+		u32 mGeneration = 0;
+	};
+
+	/**
+	* @brief Rarely used entity data ( editor label, archetype and instancing bookkeeping ). Only allocated for entities
+	*		 that use any of it, most runtime entities never do.
+	*/
+	struct EntityColdData
+	{
+		HashSet< u32 > mInstancedEntities;
+		String mName = "Entity";
+		EntityHandle mPrototypeEntity;
+		AssetHandle< Archetype > mArchetype;
+	};
+
+	/**
+	* @brief Entity data read on every handle lookup, state check, query and transform pass. Stored apart from the entity
+	*		 records in pages of its own, one entry per slot indexed by entity id, so those loops stream through 32 bytes 
+	*		 per entity instead of pulling in whole records.
+	*/
+	struct EntityHotData
+	{
+		EntityHandle mParent;
+		u64 mComponentMask = 0;
+		u32 mGeneration = 0;
+		EntityState mState = EntityState::INVALID;
+		bool mWorldTransformDirty = true;
 	};
 
 	ENJON_CLASS( )
@@ -127,6 +165,7 @@ namespace Enjon
 		friend EntityManager;
 		friend EntityArchiver;
 		friend Archetype;
+		friend EntityStorage;
 
 	public:
 
@@ -145,6 +184,11 @@ namespace Enjon
 		*/
 		u32 GetID( ) const;
 
+		/**
+		* @brief Get generation of this entity's slot. Incremented every time the slot is released.
+		*/
+		u32 GetGeneration( ) const;
+
 		/**
 		* @brief Get uuid of this entity
 		*/
@@ -251,10 +295,19 @@ namespace Enjon
 		Transform GetLocalTransform( );
 
 		/**
-		* @brief Gets World transform of entity which calculates world transform if dirty flag is set
+		* @brief Gets cached world transform of entity. If dirty flag is set, calculates it without updating the cache.
 		*/
 		Transform GetWorldTransform( );
 
+		/**
+		* @brief Changes whenever cached world transform is recalculated. Compare against a previously read version to 
+		*		 find out if the transform changed since.
+		*/
+		u32 GetTransformVersion( ) const
+		{
+			return mTransformVersion;
+		}
+
 		/**
 		* @brief Sets local position of entity relative to parent, if exists
 		*/
@@ -339,7 +392,7 @@ namespace Enjon
 		/**
 		* @brief Gets parent of this entity, returns nullptr if doesn't exist
 		*/
-		EntityHandle GetParent( ) { return mParent; }
+		EntityHandle GetParent( ) { return mHot->mParent; }
 
 		/**
 		* @brief
@@ -486,6 +539,11 @@ namespace Enjon
 		*/
 		void CalculateWorldTransform( );
 
+		/*
+		* @brief Flags cached world transform of this entity and all of its descendants for recalculation
+		*/
+		void SetWorldTransformDirty( );
+
 		/*
 		* @brief
 		*/
@@ -532,6 +590,21 @@ namespace Enjon
 		*/
 		void Reset( );
 
+		/*
+		* @brief Resets all fields of entity without unlinking it from parent, children, prototype or world first
+		*/
+		void ResetData( );
+
+		/*
+		* @brief Returns cold data of entity, allocating it if needed
+		*/
+		EntityColdData* GetColdData( );
+
+		/*
+		* @brief Frees cold data, entity reverts to defaults for all of it
+		*/
+		void ReleaseColdData( );
+
 		/*
 		* @brief
 		*/
@@ -549,54 +622,129 @@ namespace Enjon
 
 	private:
 		ENJON_PROPERTY( NonSerializeable, ReadOnly )
-		u32 mID = MAX_ENTITIES;
+		u32 mID = INVALID_ENTITY_ID;
 
-		ENJON_PROPERTY( NonSerializeable, ReadOnly )
-		EntityHandle mParent;
- 
-		ENJON_PROPERTY( NonSerializeable, ReadOnly )
-		Transform mLocalTransform;
+		// Generation, state, parent, dirty flag and component mask of this slot, see EntityHotData. Set by the storage 
+		// page that owns the entity and never changes.
+		EntityHotData* mHot = nullptr;
 
-		ENJON_PROPERTY( NonSerializeable, ReadOnly )
-		Transform mWorldTransform;
+		bool mIsArchetypeRoot = false;
+
+		// Positions in world's entity and root lists, INVALID_ENTITY_ID if not listed
+		u32 mWorldIndex = INVALID_ENTITY_ID;
+		u32 mWorldRootIndex = INVALID_ENTITY_ID;
+
+		u32 mTransformVersion = 0;
+
+		const World* mWorld = nullptr;
 
 		ENJON_PROPERTY( NonSerializeable, HideInEditor )
 		Vector<u32> mComponents;
 
 		ENJON_PROPERTY( NonSerializeable )
 		Vector< EntityHandle > mChildren;
+ 
+		ENJON_PROPERTY( NonSerializeable, ReadOnly )
+		Transform mLocalTransform;
 
-		ENJON_PROPERTY( NonSerializeable, HideInEditor, ReadOnly )
-		HashSet< u32 > mInstancedEntities;
+		ENJON_PROPERTY( NonSerializeable, ReadOnly )
+		Transform mWorldTransform;
 
+		// Generated on allocation for every entity and keyed in the uuid map, so kept inline rather than in cold data
 		ENJON_PROPERTY( NonSerializeable, ReadOnly )
 		UUID mUUID;
 
-		ENJON_PROPERTY( NonSerializeable )
-		String mName = "Entity";
+		// Allocated on first use, see GetColdData( )
+		EntityColdData* mColdData = nullptr;
+	};
 
-		ENJON_PROPERTY( NonSerializeable, ReadOnly )
-		EntityHandle mPrototypeEntity;
+	/**
+	* @brief Entities stored in fixed size pages that are allocated on demand. Pages are never moved or freed 
+	*		 before the storage itself, so entity addresses and slot generations stay valid.
+	*/
+	class EntityStorage
+	{
+		public:
 
-		ENJON_PROPERTY( NonSerializeable, ReadOnly, HideInEditor )
-		AssetHandle< Archetype > mArchetype; 
+			/**
+			* @brief Constructor
+			*/
+			EntityStorage( ) = default;
 
-		const World* mWorld = nullptr;
+			/**
+			* @brief Destructor
+			*/
+			~EntityStorage( );
+
+			/**
+			* @brief Returns entity in slot, nullptr if id is out of range
+			*/
+			Entity* Get( const u32& id ) const
+			{
+				return id < GetCapacity( ) ? &mPages[ id / ENTITY_PAGE_SIZE ][ id % ENTITY_PAGE_SIZE ] : nullptr;
+			}
+
+			/**
+			* @brief Returns hot data of slot, nullptr if id is out of range
+			*/
+			EntityHotData* GetHotData( const u32& id ) const
+			{
+				return id < GetCapacity( ) ? &mHotPages[ id / ENTITY_PAGE_SIZE ][ id % ENTITY_PAGE_SIZE ] : nullptr;
+			}
+
+			/**
+			* @brief Allocates another page and returns id of its first slot
+			*/
+			u32 AddPage( );
 
-		Enjon::EntityState mState;
+			/**
+			* @brief Number of entity slots across all pages
+			*/
+			u32 GetCapacity( ) const
+			{
+				return ( u32 )mPages.size( ) * ENTITY_PAGE_SIZE;
+			}
+
+			/**
+			* @brief
+			*/
+			u32 GetPageCount( ) const
+			{
+				return ( u32 )mPages.size( );
+			}
 
-		u32 mWorldTransformDirty : 1; 
-		u32 mIsArchetypeRoot : 1;
+		private:
+			Vector< Entity* > mPages;
+			Vector< EntityHotData* > mHotPages;
 	};
 
-	//using EntityStorage 			= std::array<Entity, MAX_ENTITIES>*;
-	using EntityStorage = Vector< Entity >;
 	using MarkedForDestructionList = Vector< u32 >;
 	using EntityList = Vector<Entity*>;
-	using ComponentBaseArray = HashMap< u32, ComponentWrapperBase* >;
+	using ComponentBaseArray = Vector< ComponentWrapperBase* >;
 	using ComponentList = Vector< Component* >;
-	using WorldEntityMap = HashMap< const World*, HashSet< Entity* > >;
-	using EntityUUIDMap = HashMap< String, Entity* >;
+
+	/**
+	* @brief Entities registered with a world, stored densely and removed by swapping with the last entry. Root 
+	*		 entities are tracked separately as they gain or lose parents.
+	*/
+	struct WorldEntityList
+	{
+		Vector< Entity* > mEntities;
+		Vector< Entity* > mRoots;
+	};
+
+	using WorldEntityMap = HashMap< const World*, WorldEntityList >;
+	using EntityUUIDMap = HashMap< UUID, Entity* >;
+
+	struct TransformHierarchyNode
+	{
+		// Parent entry for root entities
+		static const u32 InvalidParent = std::numeric_limits< u32 >::max( );
+
+		Entity* mEntity = nullptr;
+		EntityHotData* mHot = nullptr;
+		u32 mParentIndex = InvalidParent;
+	};
 
 	ENJON_CLASS( )
 	class EntityManager : public Subsystem
@@ -626,6 +774,11 @@ namespace Enjon
 		*/
 		Entity* GetRawEntity( const u32& id );
 
+		/**
+		* @brief Returns entity only if its slot is still on the given generation
+		*/
+		Entity* GetRawEntity( const u32& id, const u32& generation );
+
 		/**
 		*@brief
 		*/
@@ -732,6 +885,13 @@ namespace Enjon
 		template <typename T>
 		Vector<Component*> GetAllComponentsOfType( );
 
+		/**
+		* @brief Returns view over all entities that have every given component type. With activeOnly set, entities that
+		*		 aren't in the ACTIVE state ( pending add, marked for destruction ) are skipped.
+		*/
+		template < typename... Ts >
+		EntityQuery< Ts... > Query( bool activeOnly = false );
+
 		/**
 		*@brief
 		*/
@@ -743,7 +903,12 @@ namespace Enjon
 		/**
 		*@brief
 		*/
-		const HashSet< Entity* >& GetEntitiesByWorld( const World* world );
+		const Vector< Entity* >& GetEntitiesByWorld( const World* world );
+
+		/**
+		* @brief Entities registered with world that have no parent
+		*/
+		const Vector< Entity* >& GetRootEntitiesByWorld( const World* world );
 
 		/**
 		*@brief
@@ -765,17 +930,112 @@ namespace Enjon
 		*/
 		bool ComponentBaseExists( const u32& compIdx );
 
+		/**
+		* @brief Returns component array for given type id, nullptr if not registered
+		*/
+		ComponentWrapperBase* GetComponentBase( const u32& compIdx ) const
+		{
+			return compIdx < mComponents.size( ) ? mComponents[ compIdx ] : nullptr;
+		}
+
+		/**
+		* @brief Returns bit of component type in entity component masks, 0 if the type has none because more types were 
+		*		 registered than a mask holds. Callers fall back to the entity's component list or the component array then.
+		*/
+		u64 GetComponentMask( const u32& compIdx ) const
+		{
+			return compIdx < mComponentMasks.size( ) ? mComponentMasks[ compIdx ] : 0;
+		}
+
+		/**
+		* @brief Returns hot data of entity slot, nullptr if id is out of range
+		*/
+		const EntityHotData* GetHotData( const u32& id ) const
+		{
+			return mEntities.GetHotData( id );
+		}
+
 		/**
 		* @brief Destroys all entities - both active and pending( will clear all lists, so is not iterable safe )
 		* @note NOT SAFE TO CALL DURING ANY ENTITY UPDATE LOOP (Only call within application update)
 		*/
 		void DestroyAll( );
 
+		/**
+		* @brief Destroys every entity in world, pending ones included, and frees their components in one batched pass instead 
+		*		 of entity by entity. Graphics scene and physics removals are batched as well. Archetype roots are kept and the
+		*		 world stays registered.
+		* @note NOT SAFE TO CALL DURING ANY ENTITY UPDATE LOOP (Only call within application update)
+		*/
+		void UnloadWorld( const World* world );
+
 		/**
 		* @brief
 		*/
 		EntityHandle GetEntityByUUID( const UUID& uuid );
 
+		/**
+		* @brief Allocation statistics of pool backing given component type, nullptr if not registered
+		*/
+		const ComponentPoolStats* GetComponentPoolStats( const MetaClass* compCls ) const;
+
+		/**
+		* @brief Makes sure count entities can be allocated without growing entity storage
+		*/
+		void ReserveEntities( const u32& count );
+
+		/**
+		* @brief Makes sure count components of given type can be added without growing component storage. Registers the
+		*		 component type if necessary. Reserve entities first so sparse entries cover all ids that will be handed out.
+		*/
+		void ReserveComponents( const MetaClass* compCls, const u32& count );
+
+		/**
+		* @brief Declares which component types given component type reads and writes during its update. Overrides any
+		*		access declared through reflection. Component types without declared access always update on their own.
+		*/
+		void SetComponentAccess( const MetaClass* compCls, const Vector< const MetaClass* >& reads, const Vector< const MetaClass* >& writes );
+
+		/**
+		* @brief Per component type update timings and threads from last frame
+		*/
+		const Vector< ComponentUpdateTrace >& GetComponentUpdateTrace( ) const
+		{
+			return mScheduler.GetLastFrameTrace( );
+		}
+
+		/**
+		* @brief Component types grouped by the waves they updated in concurrently last frame
+		*/
+		const Vector< Vector< u32 > >& GetComponentUpdateWaves( ) const
+		{
+			return mScheduler.GetLastFrameWaves( );
+		}
+
+		/**
+		* @brief Changed and total component counts of given type for last frame, nullptr if not registered
+		*/
+		const ComponentChangeStats* GetComponentChangeStats( const MetaClass* compCls ) const;
+
+		/**
+		* @brief Toggles running non-conflicting component updates on the job system
+		*/
+		void EnableParallelComponentUpdates( bool enabled )
+		{
+			mScheduler.EnableParallelUpdates( enabled );
+		}
+
+		/**
+		* @brief Command buffer of calling thread. Structural changes recorded into it are made at the next sync point.
+		*/
+		EntityCommandBuffer* GetCommandBuffer( );
+
+		/**
+		* @brief Plays back all recorded commands on the calling thread in deterministic order. Called by Update once
+		*		 component updates are done. Must not be called while jobs may still be recording.
+		*/
+		void PlaybackCommandBuffers( );
+
 	protected:
 
 		/**
@@ -825,6 +1085,18 @@ namespace Enjon
 		*/
 		void RemoveEntityUnsafe( Entity* entity );
 
+		/**
+		*@brief Shuts down and frees components of all destroyed entities in one linear pass per component type. 
+		*		Component types left without any live entities have their pools released at once.
+		*/
+		void ReleaseDestroyedComponents( );
+
+		/**
+		*@brief Shuts down and frees the components of the given entities only. Component types whose pools hold nothing
+		*		but those components have their pools released at once.
+		*/
+		void ReleaseComponents( const Vector< Entity* >& entities );
+
 		/**
 		*@brief
 		*/
@@ -840,6 +1112,21 @@ namespace Enjon
 		*/
 		static b8 CompareEntityIDs( const Entity* a, const Entity* b );
 
+		/**
+		*@brief Adds entity to its world's root list if it has no parent, removes it otherwise
+		*/
+		void UpdateWorldRootEntry( Entity* entity );
+
+		/**
+		*@brief Appends entity to dense list, storing its position in given entity member
+		*/
+		static void InsertIntoDenseList( Vector< Entity* >& list, u32 Entity::* index, Entity* entity );
+
+		/**
+		*@brief Removes entity from dense list by moving last entry into its place
+		*/
+		static void EraseFromDenseList( Vector< Entity* >& list, u32 Entity::* index, Entity* entity );
+
 		/**
 		*@brief
 		*/
@@ -847,15 +1134,30 @@ namespace Enjon
 		void DetachComponentFromEntity( Entity* entity );
 
 		/**
-		*@brief
+		*@brief Pops next free entity slot, adding a new storage page if none are left
 		*/
 		u32 FindNextAvailableID( );
 
 		/**
-		*@brief
+		*@brief Adds a storage page and pushes its ids onto the free list
+		*/
+		void AddEntityPage( );
+
+		/**
+		*@brief Recalculates all dirty world transforms in parent before child order
 		*/
 		void UpdateAllActiveTransforms( f32 dt );
 
+		/**
+		*@brief Flattens active entity hierarchy breadth first into transform hierarchy array
+		*/
+		void RebuildTransformHierarchy( );
+
+		/**
+		*@brief Hierarchy needs to be flattened again before next transform update
+		*/
+		void SetTransformHierarchyDirty( );
+
 		/**
 		*@brief
 		*/
@@ -875,19 +1177,32 @@ namespace Enjon
 	private:
 		EntityStorage 				mEntities;
 		ComponentBaseArray 			mComponents;
+		Vector< u32 >				mRegisteredComponentTypes;
+		// Mask bit per component type id, handed out in registration order
+		Vector< u64 >				mComponentMasks;
+		u32							mComponentMaskBitCount = 0;
 		EntityList 					mActiveEntities;
 		EntityList 					mMarkedForAdd;
 		MarkedForDestructionList 	mMarkedForDestruction;
 		ComponentList				mNeedInitializationList;
 		ComponentList				mNeedStartList;
-		u32 						mNextAvailableID = 0;
+		Vector< u32 >				mFreeEntityIDs;
 		WorldEntityMap				mWorldEntityMap;
 		World*						mArchetypeWorld = nullptr;
 		EntityUUIDMap				mEntityUUIDMap;
+		ComponentScheduler			mScheduler;
+		Vector< EntityCommandBuffer > mCommandBuffers;
+		Vector< TransformHierarchyNode > mTransformHierarchy;
+		Vector< u32 >				mTransformHierarchyLevels;
+		bool						mTransformHierarchyDirty = true;
+		// Scratch for composing each level of the hierarchy four transforms at a time, indexed like mTransformHierarchy
+		TransformStream				mPropagationLocal;
+		TransformStream				mPropagationParent;
 	};
 
 #include "Entity/Entity.inl"
 #include "Entity/EntityManager.inl"
+#include "Entity/EntityQuery.inl"
 }
 
 #endif
@@ -4,8 +4,7 @@ template <typename T>
 void EntityManager::RegisterComponent()
 {
 	static_assert(std::is_base_of<Component, T>::value, "EntityManager::RegisterComponent:: T must inherit from Component.");
-	u32 index = static_cast<u32>(Component::GetComponentType<T>());
-	mComponents[ index ] = new ComponentArray( );
+	RegisterComponent( Object::GetClass< T >( ) );
 }
 
 //--------------------------------------------------------------------------
@@ -47,9 +46,8 @@ T* EntityManager::AddComponent(const Enjon::EntityHandle& handle)
 	}
 
 	// Make sure that component isn't still null
-	assert(mComponents.at(compIdx) != nullptr); 
-
-	ComponentWrapperBase* base = mComponents[ compIdx ];
+	ComponentWrapperBase* base = GetComponentBase( compIdx );
+	assert( base != nullptr ); 
 
 	// If component already exists
 	if ( base->HasEntity( eid ) )
@@ -69,6 +67,7 @@ T* EntityManager::AddComponent(const Enjon::EntityHandle& handle)
 
 		// Get component ptr and push back into entity components
 		entity->mComponents.push_back( compIdx ); 
+		entity->mHot->mComponentMask |= GetComponentMask( compIdx );
 
 		// Push back for need initilization and start
 		mNeedInitializationList.push_back( component );
@@ -106,9 +105,9 @@ T* EntityManager::GetComponent(Entity* entity)
 
 	// Get component idx
 	u32 compIdx = Component::GetComponentType<T>();
-	assert(mComponents.at(compIdx) != nullptr); 
+	ComponentWrapperBase* base = GetComponentBase( compIdx );
+	assert( base != nullptr ); 
 
-	ComponentWrapperBase* base = mComponents.at( compIdx );
 	return (T*)base->GetComponent( eid ); 
 }
 
@@ -128,6 +127,7 @@ void EntityManager::DetachComponentFromEntity(Entity* entity)
 	// Search through entity component list and remove reference
 	auto entComps = &entity->mComponents;
 	entComps->erase(std::remove(entComps->begin(), entComps->end(), compIdx), entComps->end());
+	entity->mHot->mComponentMask &= ~GetComponentMask( compIdx );
 
 	// Remove ptr from point list map
 	cPtrList->erase(std::remove(cPtrList->begin(), cPtrList->end(), compPtr), cPtrList->end());	
@@ -148,8 +148,7 @@ void EntityManager::DetachComponentFromEntity(Entity* entity)
 template <typename T >
 bool EntityManager::ComponentBaseExists( )
 {
-	u32 idx = Component::GetComponentType< T >( );
-	return ( mComponents.find( idx ) != mComponents.end( ) );
+	return ComponentBaseExists( Component::GetComponentType< T >( ) );
 }
 
 //=======================================================================================
@@ -174,6 +173,14 @@ Vector<Component*> EntityManager::GetAllComponentsOfType( )
 
 //=======================================================================================
 
+template < typename... Ts >
+EntityQuery< Ts... > EntityManager::Query( bool activeOnly )
+{
+	return EntityQuery< Ts... >( this, activeOnly );
+}
+
+//=======================================================================================
+
 
 
 
@@ -0,0 +1,89 @@
+// File: EntityQuery.h
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#ifndef ENJON_ENTITY_QUERY_H
+#define ENJON_ENTITY_QUERY_H
+#pragma once
+
+#include "Entity/Component.h"
+#include "System/Types.h"
+#include "Defines.h"
+
+#include <array>
+#include <utility>
+
+namespace Enjon
+{
+	class EntityManager;
+
+	/**
+	* @brief View over all entities that have every one of the given component types. Walks the slots of the smallest
+	*		 component array and checks the remaining types against each entity's component mask, or looks them up in
+	*		 their arrays for types without a mask bit, so no component lists are copied. Callbacks receive the entity 
+	*		 followed by a typed reference to each requested component.
+	*
+	*		 By default entities are visited whatever their state, same as iterating the component arrays directly.
+	*		 Constructed with activeOnly, entities that aren't ACTIVE are skipped.
+	*/
+	template < typename... Ts >
+	class EntityQuery
+	{
+		static_assert( sizeof...( Ts ) > 0, "EntityQuery:: Must query at least one component type." );
+
+		public:
+
+			/**
+			* @brief Constructor
+			*/
+			EntityQuery( EntityManager* manager, bool activeOnly = false );
+
+			/**
+			* @brief Destructor
+			*/
+			~EntityQuery( ) = default;
+
+			/**
+			* @brief Calls func( Entity*, Ts&... ) for each matching entity in storage order
+			*/
+			template < typename Func >
+			void ForEach( Func func ) const;
+
+			/**
+			* @brief Splits the driving component array into batches and calls func( Entity*, Ts&... ) for each matching entity
+			*		 on the job system. Returns once all batches are done. Func must be safe to call concurrently.
+			*/
+			template < typename Func >
+			void ParallelForEach( Func func, const u32& batchSize = ENTITY_QUERY_BATCH_SIZE ) const;
+
+			/**
+			* @brief Number of matching entities
+			*/
+			u32 Count( ) const;
+
+			/**
+			* @brief Component array iteration is driven by, nullptr if any of the types isn't registered
+			*/
+			const ComponentArray* GetDriver( ) const
+			{
+				return mDriver;
+			}
+
+		private:
+
+			/**
+			* @brief
+			*/
+			template < typename Func, std::size_t... Is >
+			void ForEachInSlotRange( Func& func, const u32& begin, const u32& end, std::index_sequence< Is... > ) const;
+
+		private:
+			std::array< ComponentArray*, sizeof...( Ts ) > mArrays;
+			ComponentArray* mDriver = nullptr;
+			const EntityManager* mManager = nullptr;
+			// Bits of all queried types, 0 if any of them has no bit
+			u64 mMask = 0;
+			bool mActiveOnly = false;
+	};
+}
+
+#endif
@@ -0,0 +1,139 @@
+//------------------------------------------------------------------------------
+template < typename... Ts >
+EntityQuery< Ts... >::EntityQuery( EntityManager* manager, bool activeOnly )
+	: mManager( manager ), mActiveOnly( activeOnly )
+{
+	u32 i = 0;
+	bool allMasked = true;
+	for ( auto& type : { GetStaticTypeId< Ts >( )... } )
+	{
+		mArrays[ i++ ] = static_cast< ComponentArray* >( manager->GetComponentBase( type ) );
+
+		u64 mask = manager->GetComponentMask( type );
+		allMasked &= mask != 0;
+		mMask |= mask;
+	}
+
+	if ( !allMasked )
+	{
+		mMask = 0;
+	}
+
+	// Drive iteration with the smallest array, any missing or empty array means nothing can match
+	for ( auto& a : mArrays )
+	{
+		if ( !a || a->IsEmpty( ) )
+		{
+			mDriver = nullptr;
+			return;
+		}
+
+		if ( !mDriver || a->GetSize( ) < mDriver->GetSize( ) )
+		{
+			mDriver = a;
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
+template < typename... Ts >
+template < typename Func, std::size_t... Is >
+void EntityQuery< Ts... >::ForEachInSlotRange( Func& func, const u32& begin, const u32& end, std::index_sequence< Is... > ) const
+{
+	for ( u32 slot = begin; slot < end; ++slot )
+	{
+		u32 eid = mDriver->GetSlotEntity( slot );
+		if ( eid == INVALID_ENTITY_ID )
+		{
+			continue;
+		}
+
+		// Mask and state come from the entity's hot data, the record is only touched for matches
+		const EntityHotData* hot = mManager->GetHotData( eid );
+		if ( !hot || ( mActiveOnly && hot->mState != EntityState::ACTIVE ) )
+		{
+			continue;
+		}
+
+		bool hasAll = true;
+		if ( mMask )
+		{
+			hasAll = ( hot->mComponentMask & mMask ) == mMask;
+		}
+		else
+		{
+			for ( auto& a : mArrays )
+			{
+				if ( a != mDriver && !a->HasEntity( eid ) )
+				{
+					hasAll = false;
+					break;
+				}
+			}
+		}
+
+		if ( !hasAll )
+		{
+			continue;
+		}
+
+		Entity* ent = mDriver->GetSlotComponent( slot )->GetEntity( );
+		if ( !ent )
+		{
+			continue;
+		}
+
+		func( ent, *static_cast< Ts* >( mArrays[ Is ]->GetComponent( eid ) )... );
+	}
+}
+
+//------------------------------------------------------------------------------
+template < typename... Ts >
+template < typename Func >
+void EntityQuery< Ts... >::ForEach( Func func ) const
+{
+	if ( !mDriver )
+	{
+		return;
+	}
+
+	ForEachInSlotRange( func, 0, mDriver->GetSlotCount( ), std::index_sequence_for< Ts... >( ) );
+}
+
+//------------------------------------------------------------------------------
+template < typename... Ts >
+template < typename Func >
+void EntityQuery< Ts... >::ParallelForEach( Func func, const u32& batchSize ) const
+{
+	if ( !mDriver )
+	{
+		return;
+	}
+
+	JobSystem* jobSystem = EngineSubsystem( JobSystem );
+	if ( !jobSystem )
+	{
+		ForEach( func );
+		return;
+	}
+
+	jobSystem->ParallelFor( mDriver->GetSlotCount( ), batchSize, [ & ]( const u32& begin, const u32& end )
+	{
+		ForEachInSlotRange( func, begin, end, std::index_sequence_for< Ts... >( ) );
+	} );
+}
+
+//------------------------------------------------------------------------------
+template < typename... Ts >
+u32 EntityQuery< Ts... >::Count( ) const
+{
+	u32 count = 0;
+	ForEach( [ &count ]( Entity*, Ts&... )
+	{
+		count++;
+	} );
+
+	return count;
+}
+
+//------------------------------------------------------------------------------
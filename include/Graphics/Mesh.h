@@ -5,6 +5,7 @@
 #include "System/Types.h"
 #include "Defines.h"
 #include "Math/Maths.h"
+#include "Math/Bounds.h"
 #include "Graphics/Vertex.h"
 #include "Asset/Asset.h" 
 
@@ -148,6 +149,11 @@ namespace Enjon
 			*/
 			u32 GetIBO( ) const;
 
+			/*
+			* @brief Object space bounds of vertex positions
+			*/
+			const Bounds& GetBounds( ) const;
+
 		protected: 
 
 			/*
@@ -155,6 +161,11 @@ namespace Enjon
 			*/
 			Result Release( ); 
 
+			/*
+			* @brief Calculates bounds from the position attribute of vertex data and grows owning mesh's bounds with them
+			*/
+			void CalculateBounds( );
+
 		public:
 			/*
 			* @brief
@@ -180,12 +191,14 @@ namespace Enjon
 			GLuint mVAO = 0;
 			GLuint mVBO = 0;
 			GLuint mIBO = 0;
+			Bounds mBounds;
 	}; 
 
 	ENJON_CLASS( )
 	class Mesh : public Asset
 	{
 		friend MeshAssetLoader;
+		friend SubMesh;
 
 		ENJON_CLASS_BODY( Mesh )
 
@@ -211,6 +224,11 @@ namespace Enjon
 			*/
 			const VertexDataDeclaration& GetVertexDeclaration( );
 
+			/*
+			* @brief Object space bounds of all submeshes
+			*/
+			const Bounds& GetBounds( ) const;
+
 		protected:
 
 			/*
@@ -249,6 +267,7 @@ namespace Enjon
 		protected: 
 			VertexDataDeclaration mVertexDecl;
 			Vector< SubMesh* > mSubMeshes;
+			Bounds mBounds;
 	}; 
 }
 
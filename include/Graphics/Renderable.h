@@ -8,6 +8,7 @@
 #include "Defines.h"
 #include "Math/Transform.h"
 #include "Math/Quaternion.h"
+#include "Math/Bounds.h"
 #include "System/Types.h"
 #include "Asset/Asset.h"
 #include "Base/Object.h"
@@ -121,6 +122,11 @@ namespace Enjon
 			*/
 			const Mat4x4 GetPreviousModelMatrix( ) const;
 
+			/** 
+			* @brief World space bounds of mesh. Cached until transform or mesh change. Invalid while mesh has no bounds.
+			*/
+			const Bounds& GetWorldBounds( );
+
 		public:
 
 			/** 
@@ -175,11 +181,14 @@ namespace Enjon
 			ENJON_PROPERTY( )
 			Vector<AssetHandle<Material>> mMaterialElements; 
 
-			u32 mRenderableID = MAX_ENTITIES; 
+			u32 mRenderableID = INVALID_ENTITY_ID; 
 			Transform mTransform; 
 			GraphicsScene* mGraphicsScene = nullptr;
 			Mat4x4 mPreviousModelMatrix = Mat4x4::Identity( );
 			Mat4x4 mCurrentModelMatrix = Mat4x4::Identity( );
+			Bounds mWorldBounds;
+			const Mesh* mWorldBoundsMesh = nullptr;
+			bool mWorldBoundsDirty = true;
 	};
 }
 
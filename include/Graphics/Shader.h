@@ -16,8 +16,41 @@
 
 #include <vector>
 
+// Uniform block holding per frame and per camera data in every shader graph shader
+#define FRAME_UNIFORM_BLOCK_NAME "FrameData"
+#define FRAME_UNIFORM_BLOCK_BINDING 0
+
 namespace Enjon
 { 
+	/**
+	* @brief Location of a uniform in a linked shader, resolved once by name instead of on every set. Handles of
+	*		 uniforms the shader doesn't use are -1 and setting them does nothing.
+	*/
+	using UniformHandle = s32;
+
+	/**
+	* @brief Per draw uniforms declared by every shader graph shader, resolved when the shader is linked
+	*/
+	enum class BuiltInUniform : u32
+	{
+		Model,
+		PreviousModel,
+		ObjectID,
+		JointTransforms,
+		Count
+	};
+
+	/**
+	* @brief CPU side of the FRAME_UNIFORM_BLOCK_NAME block, matches its std140 layout
+	*/
+	struct FrameUniformBlock
+	{
+		Mat4x4 mViewProjection;
+		Mat4x4 mPreviousViewProjection;
+		Vec3 mViewPositionWorldSpace;
+		f32 mWorldTime;
+	};
+
 	class Shader
 	{
 		public:
@@ -87,6 +120,25 @@ namespace Enjon
 			void SetUniform( const std::string& name, const ColorRGBA32& color );
 			void SetUniformArrayElement( const std::string& name, const u32& index, const Mat4x4& mat );
 
+			/*
+			* @brief Handle of uniform by name. Arrays can be named with or without their [0] suffix.
+			*/
+			UniformHandle GetUniformHandle( const Enjon::String& uniformName ) const;
+
+			/*
+			* @brief Handle of built in uniform resolved at link time
+			*/
+			UniformHandle GetUniformHandle( const BuiltInUniform& uniform ) const;
+
+			void SetUniform( const UniformHandle& handle, const s32& val );
+			void SetUniform( const UniformHandle& handle, const f32& val );
+			void SetUniform( const UniformHandle& handle, const Vec2& vector );
+			void SetUniform( const UniformHandle& handle, const Vec3& vector );
+			void SetUniform( const UniformHandle& handle, const Vec4& vector );
+			void SetUniform( const UniformHandle& handle, const Mat4x4& matrix );
+			void SetUniform( const UniformHandle& handle, const ColorRGBA32& color );
+			void SetUniformArrayElement( const UniformHandle& handle, const u32& index, const Mat4x4& mat );
+
 			void BindTexture(const std::string& name, const u32& TextureID, const u32 Index);
 
 		private:
@@ -111,6 +163,7 @@ namespace Enjon
 			u32 mVertexShaderID		= 0;
 			u32 mFragmentShaderID	= 0;
 			std::unordered_map< Enjon::String, u32 > mUniformMap;
+			UniformHandle mBuiltInUniforms[ ( u32 )BuiltInUniform::Count ] = { -1, -1, -1, -1 };
 			ShaderPassType mPassType;
 			AssetHandle<ShaderGraph> mGraph;
 	}; 
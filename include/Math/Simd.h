@@ -0,0 +1,360 @@
+// Copyright 2016-2017 John Jackson. All Rights Reserved.
+// File: Simd.h
+
+#pragma once
+#ifndef ENJON_SIMD_H
+#define ENJON_SIMD_H
+
+#include <Defines.h>
+#include <System/Types.h>
+
+#include <cmath>
+
+// Define ENJON_MATH_SCALAR to build the math core without SSE
+#if !defined( ENJON_MATH_SCALAR ) && ( defined( _M_X64 ) || defined( _M_AMD64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 1 ) || defined( __SSE__ ) )
+	#define ENJON_MATH_SSE 1
+	#include <xmmintrin.h>
+#else
+	#define ENJON_MATH_SSE 0
+#endif
+
+/*
+* Kernels behind Vec4, Quaternion, Mat4x4 and Transform math. They work on raw f32 arrays laid out like those classes
+* ( x, y, z, w and column major matrices ) so the scalar reference and the SSE path can be compared side by side. Both
+* evaluate in the same order, so results only differ where the compiler contracts scalar math differently.
+*/
+
+namespace Enjon
+{
+	namespace Simd
+	{
+		namespace Scalar
+		{
+			//=======================================================================================
+
+			inline f32 Dot4( const f32* a, const f32* b )
+			{
+				return a[ 0 ] * b[ 0 ] + a[ 1 ] * b[ 1 ] + a[ 2 ] * b[ 2 ] + a[ 3 ] * b[ 3 ];
+			}
+
+			//=======================================================================================
+
+			inline void Add4( const f32* a, const f32* b, f32* out )
+			{
+				for ( u32 i = 0; i < 4; ++i ) out[ i ] = a[ i ] + b[ i ];
+			}
+
+			inline void Subtract4( const f32* a, const f32* b, f32* out )
+			{
+				for ( u32 i = 0; i < 4; ++i ) out[ i ] = a[ i ] - b[ i ];
+			}
+
+			inline void Multiply4( const f32* a, const f32* b, f32* out )
+			{
+				for ( u32 i = 0; i < 4; ++i ) out[ i ] = a[ i ] * b[ i ];
+			}
+
+			inline void Divide4( const f32* a, const f32* b, f32* out )
+			{
+				for ( u32 i = 0; i < 4; ++i ) out[ i ] = a[ i ] / b[ i ];
+			}
+
+			//=======================================================================================
+
+			// Divides by length, same as Quaternion::Normalize( ) and Vec4::Normalize( ) always did
+			inline void Normalize4( const f32* v, f32* out )
+			{
+				f32 length = std::sqrt( Dot4( v, v ) );
+				for ( u32 i = 0; i < 4; ++i ) out[ i ] = v[ i ] / length;
+			}
+
+			//=======================================================================================
+
+			inline void QuatMultiply( const f32* a, const f32* b, f32* out )
+			{
+				f32 r[ 4 ];
+				r[ 0 ] = a[ 3 ] * b[ 0 ] + a[ 0 ] * b[ 3 ] + a[ 1 ] * b[ 2 ] - a[ 2 ] * b[ 1 ];
+				r[ 1 ] = a[ 3 ] * b[ 1 ] + a[ 1 ] * b[ 3 ] + a[ 2 ] * b[ 0 ] - a[ 0 ] * b[ 2 ];
+				r[ 2 ] = a[ 3 ] * b[ 2 ] + a[ 2 ] * b[ 3 ] + a[ 0 ] * b[ 1 ] - a[ 1 ] * b[ 0 ];
+				r[ 3 ] = a[ 3 ] * b[ 3 ] - a[ 0 ] * b[ 0 ] - a[ 1 ] * b[ 1 ] - a[ 2 ] * b[ 2 ];
+				for ( u32 i = 0; i < 4; ++i ) out[ i ] = r[ i ];
+			}
+
+			//=======================================================================================
+
+			// v + 2w( q x v ) + 2( q x ( q x v ) ), v and out are 3 floats
+			inline void QuatRotate( const f32* q, const f32* v, f32* out )
+			{
+				f32 uv[ 3 ] =
+				{
+					q[ 1 ] * v[ 2 ] - q[ 2 ] * v[ 1 ],
+					q[ 2 ] * v[ 0 ] - q[ 0 ] * v[ 2 ],
+					q[ 0 ] * v[ 1 ] - q[ 1 ] * v[ 0 ]
+				};
+				f32 uuv[ 3 ] =
+				{
+					q[ 1 ] * uv[ 2 ] - q[ 2 ] * uv[ 1 ],
+					q[ 2 ] * uv[ 0 ] - q[ 0 ] * uv[ 2 ],
+					q[ 0 ] * uv[ 1 ] - q[ 1 ] * uv[ 0 ]
+				};
+
+				f32 w2 = 2.0f * q[ 3 ];
+				for ( u32 i = 0; i < 3; ++i )
+				{
+					out[ i ] = v[ i ] + uv[ i ] * w2 + uuv[ i ] * 2.0f;
+				}
+			}
+
+			//=======================================================================================
+
+			// sa * a + sb * b
+			inline void Blend4( const f32* a, const f32& sa, const f32* b, const f32& sb, f32* out )
+			{
+				for ( u32 i = 0; i < 4; ++i ) out[ i ] = sa * a[ i ] + sb * b[ i ];
+			}
+
+			//=======================================================================================
+
+			inline void Mat4MultiplyVec4( const f32* m, const f32* v, f32* out )
+			{
+				f32 r[ 4 ];
+				for ( u32 i = 0; i < 4; ++i )
+				{
+					r[ i ] = m[ i ] * v[ 0 ] + m[ i + 4 ] * v[ 1 ] + m[ i + 8 ] * v[ 2 ] + m[ i + 12 ] * v[ 3 ];
+				}
+				for ( u32 i = 0; i < 4; ++i ) out[ i ] = r[ i ];
+			}
+
+			// Transforms point with implicit w of 1, v and out are 3 floats
+			inline void Mat4MultiplyPoint( const f32* m, const f32* v, f32* out )
+			{
+				f32 r[ 3 ];
+				for ( u32 i = 0; i < 3; ++i )
+				{
+					r[ i ] = m[ i ] * v[ 0 ] + m[ i + 4 ] * v[ 1 ] + m[ i + 8 ] * v[ 2 ] + m[ i + 12 ];
+				}
+				for ( u32 i = 0; i < 3; ++i ) out[ i ] = r[ i ];
+			}
+
+			//=======================================================================================
+
+			// out = a * b, out may alias either input
+			inline void Mat4Multiply( const f32* a, const f32* b, f32* out )
+			{
+				f32 r[ 16 ];
+				for ( u32 c = 0; c < 4; ++c )
+				{
+					for ( u32 i = 0; i < 4; ++i )
+					{
+						f32 sum = 0.0f;
+						for ( u32 e = 0; e < 4; ++e )
+						{
+							sum += a[ i + e * 4 ] * b[ e + c * 4 ];
+						}
+						r[ i + c * 4 ] = sum;
+					}
+				}
+				for ( u32 i = 0; i < 16; ++i ) out[ i ] = r[ i ];
+			}
+
+			//=======================================================================================
+		}
+
+#if ENJON_MATH_SSE
+		namespace SSE
+		{
+			//=======================================================================================
+
+			inline __m128 Load3( const f32* v )
+			{
+				return _mm_set_ps( 0.0f, v[ 2 ], v[ 1 ], v[ 0 ] );
+			}
+
+			inline void Store3( const __m128& v, f32* out )
+			{
+				f32 r[ 4 ];
+				_mm_storeu_ps( r, v );
+				out[ 0 ] = r[ 0 ];
+				out[ 1 ] = r[ 1 ];
+				out[ 2 ] = r[ 2 ];
+			}
+
+			inline __m128 Splat( const __m128& v, const u32& lane )
+			{
+				switch ( lane )
+				{
+					case 0: return _mm_shuffle_ps( v, v, _MM_SHUFFLE( 0, 0, 0, 0 ) );
+					case 1: return _mm_shuffle_ps( v, v, _MM_SHUFFLE( 1, 1, 1, 1 ) );
+					case 2: return _mm_shuffle_ps( v, v, _MM_SHUFFLE( 2, 2, 2, 2 ) );
+					default: return _mm_shuffle_ps( v, v, _MM_SHUFFLE( 3, 3, 3, 3 ) );
+				}
+			}
+
+			// Sums lanes left to right like the scalar path and splats the result
+			inline __m128 Dot4( const __m128& a, const __m128& b )
+			{
+				__m128 m = _mm_mul_ps( a, b );
+				__m128 s = _mm_add_ss( m, _mm_shuffle_ps( m, m, _MM_SHUFFLE( 1, 1, 1, 1 ) ) );
+				s = _mm_add_ss( s, _mm_shuffle_ps( m, m, _MM_SHUFFLE( 2, 2, 2, 2 ) ) );
+				s = _mm_add_ss( s, _mm_shuffle_ps( m, m, _MM_SHUFFLE( 3, 3, 3, 3 ) ) );
+				return _mm_shuffle_ps( s, s, _MM_SHUFFLE( 0, 0, 0, 0 ) );
+			}
+
+			// a x b for x, y, z lanes, w lane is 0
+			inline __m128 Cross3( const __m128& a, const __m128& b )
+			{
+				__m128 aYZX = _mm_shuffle_ps( a, a, _MM_SHUFFLE( 3, 0, 2, 1 ) );
+				__m128 bZXY = _mm_shuffle_ps( b, b, _MM_SHUFFLE( 3, 1, 0, 2 ) );
+				__m128 aZXY = _mm_shuffle_ps( a, a, _MM_SHUFFLE( 3, 1, 0, 2 ) );
+				__m128 bYZX = _mm_shuffle_ps( b, b, _MM_SHUFFLE( 3, 0, 2, 1 ) );
+				return _mm_sub_ps( _mm_mul_ps( aYZX, bZXY ), _mm_mul_ps( aZXY, bYZX ) );
+			}
+
+			//=======================================================================================
+
+			inline f32 Dot4( const f32* a, const f32* b )
+			{
+				return _mm_cvtss_f32( Dot4( _mm_loadu_ps( a ), _mm_loadu_ps( b ) ) );
+			}
+
+			//=======================================================================================
+
+			inline void Add4( const f32* a, const f32* b, f32* out )
+			{
+				_mm_storeu_ps( out, _mm_add_ps( _mm_loadu_ps( a ), _mm_loadu_ps( b ) ) );
+			}
+
+			inline void Subtract4( const f32* a, const f32* b, f32* out )
+			{
+				_mm_storeu_ps( out, _mm_sub_ps( _mm_loadu_ps( a ), _mm_loadu_ps( b ) ) );
+			}
+
+			inline void Multiply4( const f32* a, const f32* b, f32* out )
+			{
+				_mm_storeu_ps( out, _mm_mul_ps( _mm_loadu_ps( a ), _mm_loadu_ps( b ) ) );
+			}
+
+			inline void Divide4( const f32* a, const f32* b, f32* out )
+			{
+				_mm_storeu_ps( out, _mm_div_ps( _mm_loadu_ps( a ), _mm_loadu_ps( b ) ) );
+			}
+
+			//=======================================================================================
+
+			inline void Normalize4( const f32* v, f32* out )
+			{
+				__m128 a = _mm_loadu_ps( v );
+				__m128 length = _mm_sqrt_ps( Dot4( a, a ) );
+				_mm_storeu_ps( out, _mm_div_ps( a, length ) );
+			}
+
+			//=======================================================================================
+
+			inline void QuatMultiply( const f32* qa, const f32* qb, f32* out )
+			{
+				__m128 a = _mm_loadu_ps( qa );
+				__m128 b = _mm_loadu_ps( qb );
+
+				// Flips sign of w lane
+				const __m128 signW = _mm_set_ps( -0.0f, 0.0f, 0.0f, 0.0f );
+
+				// ( aw bx, aw by, aw bz, aw bw )
+				__m128 r = _mm_mul_ps( Splat( a, 3 ), b );
+				// ( ax bw, ay bw, az bw, -ax bx )
+				__m128 t1 = _mm_mul_ps( _mm_shuffle_ps( a, a, _MM_SHUFFLE( 0, 2, 1, 0 ) ), _mm_shuffle_ps( b, b, _MM_SHUFFLE( 0, 3, 3, 3 ) ) );
+				r = _mm_add_ps( r, _mm_xor_ps( t1, signW ) );
+				// ( ay bz, az bx, ax by, -ay by )
+				__m128 t2 = _mm_mul_ps( _mm_shuffle_ps( a, a, _MM_SHUFFLE( 1, 0, 2, 1 ) ), _mm_shuffle_ps( b, b, _MM_SHUFFLE( 1, 1, 0, 2 ) ) );
+				r = _mm_add_ps( r, _mm_xor_ps( t2, signW ) );
+				// ( az by, ax bz, ay bx, az bz ), all subtracted
+				__m128 t3 = _mm_mul_ps( _mm_shuffle_ps( a, a, _MM_SHUFFLE( 2, 1, 0, 2 ) ), _mm_shuffle_ps( b, b, _MM_SHUFFLE( 2, 0, 2, 1 ) ) );
+				r = _mm_sub_ps( r, t3 );
+
+				_mm_storeu_ps( out, r );
+			}
+
+			//=======================================================================================
+
+			inline void QuatRotate( const f32* quat, const f32* vec, f32* out )
+			{
+				__m128 q = _mm_loadu_ps( quat );
+				__m128 v = Load3( vec );
+
+				__m128 uv = Cross3( q, v );
+				__m128 uuv = Cross3( q, uv );
+
+				__m128 w2 = _mm_mul_ps( _mm_set1_ps( 2.0f ), Splat( q, 3 ) );
+				__m128 r = _mm_add_ps( v, _mm_mul_ps( uv, w2 ) );
+				r = _mm_add_ps( r, _mm_mul_ps( uuv, _mm_set1_ps( 2.0f ) ) );
+
+				Store3( r, out );
+			}
+
+			//=======================================================================================
+
+			inline void Blend4( const f32* a, const f32& sa, const f32* b, const f32& sb, f32* out )
+			{
+				__m128 r = _mm_add_ps( _mm_mul_ps( _mm_set1_ps( sa ), _mm_loadu_ps( a ) ), _mm_mul_ps( _mm_set1_ps( sb ), _mm_loadu_ps( b ) ) );
+				_mm_storeu_ps( out, r );
+			}
+
+			//=======================================================================================
+
+			// Linear combination of matrix columns, summed in the same order as the scalar loops
+			inline __m128 Mat4MultiplyColumn( const __m128* m, const __m128& v )
+			{
+				__m128 r = _mm_mul_ps( m[ 0 ], Splat( v, 0 ) );
+				r = _mm_add_ps( r, _mm_mul_ps( m[ 1 ], Splat( v, 1 ) ) );
+				r = _mm_add_ps( r, _mm_mul_ps( m[ 2 ], Splat( v, 2 ) ) );
+				r = _mm_add_ps( r, _mm_mul_ps( m[ 3 ], Splat( v, 3 ) ) );
+				return r;
+			}
+
+			inline void Mat4MultiplyVec4( const f32* m, const f32* v, f32* out )
+			{
+				__m128 cols[ 4 ] = { _mm_loadu_ps( m ), _mm_loadu_ps( m + 4 ), _mm_loadu_ps( m + 8 ), _mm_loadu_ps( m + 12 ) };
+				_mm_storeu_ps( out, Mat4MultiplyColumn( cols, _mm_loadu_ps( v ) ) );
+			}
+
+			inline void Mat4MultiplyPoint( const f32* m, const f32* v, f32* out )
+			{
+				__m128 p = Load3( v );
+				__m128 r = _mm_mul_ps( _mm_loadu_ps( m ), Splat( p, 0 ) );
+				r = _mm_add_ps( r, _mm_mul_ps( _mm_loadu_ps( m + 4 ), Splat( p, 1 ) ) );
+				r = _mm_add_ps( r, _mm_mul_ps( _mm_loadu_ps( m + 8 ), Splat( p, 2 ) ) );
+				r = _mm_add_ps( r, _mm_loadu_ps( m + 12 ) );
+				Store3( r, out );
+			}
+
+			//=======================================================================================
+
+			inline void Mat4Multiply( const f32* a, const f32* b, f32* out )
+			{
+				__m128 cols[ 4 ] = { _mm_loadu_ps( a ), _mm_loadu_ps( a + 4 ), _mm_loadu_ps( a + 8 ), _mm_loadu_ps( a + 12 ) };
+
+				// Read all of b before writing, out may alias it
+				__m128 r0 = Mat4MultiplyColumn( cols, _mm_loadu_ps( b ) );
+				__m128 r1 = Mat4MultiplyColumn( cols, _mm_loadu_ps( b + 4 ) );
+				__m128 r2 = Mat4MultiplyColumn( cols, _mm_loadu_ps( b + 8 ) );
+				__m128 r3 = Mat4MultiplyColumn( cols, _mm_loadu_ps( b + 12 ) );
+
+				_mm_storeu_ps( out, r0 );
+				_mm_storeu_ps( out + 4, r1 );
+				_mm_storeu_ps( out + 8, r2 );
+				_mm_storeu_ps( out + 12, r3 );
+			}
+
+			//=======================================================================================
+		}
+#endif
+
+		// Kernels used by the math classes
+#if ENJON_MATH_SSE
+		namespace Active = SSE;
+#else
+		namespace Active = Scalar;
+#endif
+	}
+}
+
+#endif
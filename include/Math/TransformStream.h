@@ -0,0 +1,119 @@
+// Copyright 2016-2017 John Jackson. All Rights Reserved.
+// File: TransformStream.h
+
+#pragma once
+#ifndef ENJON_TRANSFORM_STREAM_H
+#define ENJON_TRANSFORM_STREAM_H
+
+#include <Defines.h>
+#include <System/Types.h>
+#include <Math/Transform.h>
+
+namespace Enjon
+{
+	/*
+	* @brief Float arrays making up a TransformStream
+	*/
+	enum class TransformChannel : u32
+	{
+		PositionX,
+		PositionY,
+		PositionZ,
+		RotationX,
+		RotationY,
+		RotationZ,
+		RotationW,
+		ScaleX,
+		ScaleY,
+		ScaleZ,
+		Count
+	};
+
+	/*
+	* @brief Many VQS transforms stored as separate float arrays ( structure of arrays ), so bulk kernels can work on
+	*		 four transforms per SSE register instead of one Transform object at a time. Kernels take a [ begin, end )
+	*		 range so disjoint ranges of the same streams can be processed on different threads. Results match the
+	*		 equivalent Transform operations to within float rounding.
+	*/
+	class TransformStream
+	{
+		public:
+
+			/**
+			* @brief
+			*/
+			TransformStream( ) = default;
+
+			/**
+			* @brief Constructs stream of count identity transforms
+			*/
+			TransformStream( const u32& count );
+
+			/**
+			* @brief
+			*/
+			~TransformStream( ) = default;
+
+			/**
+			* @brief Resizes stream, new entries are identity transforms
+			*/
+			void Resize( const u32& count );
+
+			/**
+			* @brief
+			*/
+			void Clear( );
+
+			/**
+			* @brief
+			*/
+			u32 GetCount( ) const;
+
+			/**
+			* @brief Writes transform into stream at index
+			*/
+			void Set( const u32& index, const Transform& transform );
+
+			/**
+			* @brief Reads transform at index back out of stream
+			*/
+			Transform Get( const u32& index ) const;
+
+			/**
+			* @brief Raw array of one channel, GetCount( ) floats long
+			*/
+			f32* GetChannel( const TransformChannel& channel );
+
+			/**
+			* @brief Raw array of one channel, GetCount( ) floats long
+			*/
+			const f32* GetChannel( const TransformChannel& channel ) const;
+
+			/**
+			* @brief Same as out[ i ] = local[ i ] * parent[ i ] for every i in range. Out can be either input stream.
+			*/
+			static void Compose( const TransformStream& local, const TransformStream& parent, TransformStream& out, const u32& begin, const u32& end );
+
+			/**
+			* @brief Same as out[ i ] = world[ i ] / parent[ i ] for every i in range. Out can be either input stream.
+			*/
+			static void InverseCompose( const TransformStream& world, const TransformStream& parent, TransformStream& out, const u32& begin, const u32& end );
+
+			/**
+			* @brief Same as out[ i ] = stream[ i ].ToMat4x4( ) for every i in range
+			*/
+			static void ToMatrices( const TransformStream& stream, Mat4x4* out, const u32& begin, const u32& end );
+
+			/**
+			* @brief Transforms points[ i ] by stream[ i ] for every i in range, same as stream[ i ].ToMat4x4( ) * points[ i ].
+			*		 Out can be points.
+			*/
+			static void TransformPoints( const TransformStream& stream, const Vec3* points, Vec3* out, const u32& begin, const u32& end );
+
+		private:
+			Vector< f32 > mChannels[ ( u32 )TransformChannel::Count ];
+	};
+}
+
+
+#endif
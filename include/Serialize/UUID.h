@@ -69,6 +69,24 @@ namespace Enjon
 			*/
 			bool operator!=( const UUID &other ) const;
 
+			/*
+			* @brief Byte-wise ordering, for sorted containers
+			*/
+			bool operator<( const UUID &other ) const;
+
+			/*
+			* @brief Raw 16 bytes of uuid
+			*/
+			const u8* GetBytes( ) const
+			{
+				return mBytes;
+			}
+
+			/*
+			* @brief Hash of all 128 bits, cheap enough to key hash maps with
+			*/
+			usize Hash( ) const;
+
 		private:
 
 			/*
@@ -82,8 +100,20 @@ namespace Enjon
 			friend std::ostream &operator<<( std::ostream &s, const UUID &uuid );
  
 		private: 
-			Vector<u8> mBytes; 
+			u8 mBytes[ 16 ]; 
 	}; 
 }
 
+namespace std
+{
+	template <>
+	struct hash< Enjon::UUID >
+	{
+		std::size_t operator()( const Enjon::UUID& uuid ) const
+		{
+			return uuid.Hash( );
+		}
+	};
+}
+
 #endif
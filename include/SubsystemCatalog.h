@@ -5,6 +5,7 @@
 #define	ENJON_SUBSYSTEM_CATALOG_H
 
 #include "Base/Object.h"
+#include "Base/StaticTypeId.h"
 #include "System/Types.h"
 #include "Defines.h"
 #include "Subsystem.h"
@@ -14,6 +15,26 @@
 
 namespace Enjon
 {
+	/**
+	*@brief Per type cache of registered subsystem, filled once registered so lookups avoid the catalog's hash map.
+	*		NOTE(): Static storage is per module, so modules other than the engine fill their own copy lazily on first use.
+	*		Each cache remembers the catalog generation it was filled in and is refilled once that catalog is gone, so 
+	*		every module's copy is invalidated without the engine having to reach into other modules ( which may have 
+	*		been unloaded by then ).
+	*/
+	template <typename T>
+	struct SubsystemCache
+	{
+		static T* sInstance;
+		static u32 sGeneration;
+	};
+
+	template <typename T>
+	T* SubsystemCache<T>::sInstance = nullptr;
+
+	template <typename T>
+	u32 SubsystemCache<T>::sGeneration = 0;
+
 	class SubsystemCatalog : public Enjon::Object
 	{
 		public:
@@ -46,6 +67,10 @@ namespace Enjon
 				// Set into map
 				mSubsystems[idx] = system;
 
+				// Cache pointer for EngineSubsystem lookups
+				SubsystemCache<T>::sInstance = system;
+				SubsystemCache<T>::sGeneration = mGeneration;
+
 				// Initialize system if set to true
 				if ( initialize )
 				{
@@ -77,6 +102,29 @@ namespace Enjon
 				return nullptr; 
 			}
 
+			/**
+			*@brief Returns cached pointer to registered subsystem, only hitting the catalog on first use with each catalog.
+			*@return The subsystem if registered, nullptr if not.
+			*/
+			template <typename T>
+			static T* GetCached()
+			{
+				if ( SubsystemCache<T>::sGeneration == mGeneration )
+				{
+					return SubsystemCache<T>::sInstance;
+				}
+
+				// Filled by an earlier catalog, or never. Only remembered once found, since it may not be registered yet.
+				T* system = mInstance ? const_cast< T* >( mInstance->Get<T>() ) : nullptr;
+				if ( system )
+				{
+					SubsystemCache<T>::sInstance = system;
+					SubsystemCache<T>::sGeneration = mGeneration;
+				}
+
+				return system;
+			}
+
 			/**
 			* @brief
 			*/
@@ -105,12 +153,13 @@ namespace Enjon
 				static_assert( std::is_base_of<Subsystem, T>::value,
 					"GetSubsystemTypeId:: T must inherit from Subsystem." );
 
-				return Engine::GetInstance( )->GetMetaClassRegistry( )->GetTypeId< T >( ); 
+				return GetStaticTypeId< T >( ); 
 			} 
 
 		private: 
 			HashMap<u32, Subsystem*> mSubsystems; 
 			static SubsystemCatalog* mInstance;
+			static u32 mGeneration;
 	};
 }
 
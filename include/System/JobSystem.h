@@ -0,0 +1,91 @@
+// @file JobSystem.h
+// Copyright 2016-2018 John Jackson. All Rights Reserved.
+
+#pragma once
+#ifndef ENJON_JOB_SYSTEM_H
+#define ENJON_JOB_SYSTEM_H
+
+#include "System/Types.h"
+#include "Subsystem.h"
+#include "Defines.h"
+
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+
+namespace Enjon
+{
+	using Job = std::function< void( ) >;
+	using ParallelForFunction = std::function< void( const u32& begin, const u32& end ) >;
+
+	ENJON_CLASS( )
+	class JobSystem : public Subsystem
+	{
+		ENJON_CLASS_BODY( JobSystem )
+
+		public:
+
+			/**
+			*@brief Spawns one worker per available hardware thread, minus the calling thread
+			*/
+			virtual Result Initialize() override;
+
+			/**
+			*@brief
+			*/
+			virtual void Update( const f32 dT ) override;
+
+			/**
+			*@brief Joins all worker threads. Any queued jobs are finished beforehand.
+			*/
+			virtual Result Shutdown() override;
+
+			/**
+			*@brief Runs all jobs across the workers and returns once every job has completed. The calling thread
+			*		helps with execution while waiting, so this is safe to call from within a job.
+			*/
+			void RunAndWait( const Vector< Job >& jobs );
+
+			/**
+			*@brief Splits [0, count) into batches of at most batchSize and calls func( begin, end ) for each batch in parallel. Returns once all batches are done.
+			*/
+			void ParallelFor( const u32& count, const u32& batchSize, const ParallelForFunction& func );
+
+			/**
+			*@brief Number of worker threads, not including the calling thread
+			*/
+			u32 GetWorkerCount( ) const
+			{
+				return ( u32 )mWorkers.size( );
+			}
+
+			/**
+			*@brief Index of thread currently executing. 0 for the main thread, 1..N for workers.
+			*/
+			static u32 GetCurrentThreadIndex( );
+
+		protected:
+
+			/**
+			*@brief
+			*/
+			void WorkerLoop( const u32& threadIndex );
+
+			/**
+			*@brief Pops and executes a single queued job, returns false if queue was empty
+			*/
+			bool ExecuteNextJob( );
+
+		protected:
+			Vector< std::thread > mWorkers;
+			std::deque< Job > mQueue;
+			std::mutex mQueueMutex;
+			std::condition_variable mQueueCondition;
+			bool mRunning = false;
+	};
+}
+
+#endif